@@ -27,6 +27,7 @@
 #define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_ASSIGNER_HPP_
 
 #include <variant>
+#include <functional>
 #include <stack>
 
 #include <boost/format.hpp>
@@ -53,12 +54,16 @@
 #include "llvm/IR/GetElementPtrTypeIterator.h"
 
 #include <nil/blueprint/logger.hpp>
+#include <nil/blueprint/circuit_cache.hpp>
 #include <nil/blueprint/layout_resolver.hpp>
 #include <nil/blueprint/macros.hpp>
+#include <nil/blueprint/replay_log.hpp>
 #include <nil/blueprint/input_reader.hpp>
 #include <nil/blueprint/memory.hpp>
 #include <nil/blueprint/non_native_marshalling.hpp>
 #include <nil/blueprint/stack.hpp>
+#include <nil/blueprint/folding.hpp>
+#include <nil/blueprint/range_facts.hpp>
 #include <nil/blueprint/integers/addition.hpp>
 #include <nil/blueprint/integers/subtraction.hpp>
 #include <nil/blueprint/integers/multiplication.hpp>
@@ -76,14 +81,17 @@
 
 #include <nil/blueprint/fields/addition.hpp>
 #include <nil/blueprint/fields/subtraction.hpp>
+#include <nil/blueprint/fields/linear_combination.hpp>
 #include <nil/blueprint/fields/multiplication.hpp>
 #include <nil/blueprint/fields/division.hpp>
 
 #include <nil/blueprint/curves/addition.hpp>
 #include <nil/blueprint/curves/subtraction.hpp>
 #include <nil/blueprint/curves/multiplication.hpp>
+#include <nil/blueprint/curves/msm.hpp>
 #include <nil/blueprint/curves/init.hpp>
 
+#include <nil/blueprint/hashes/poseidon.hpp>
 #include <nil/blueprint/hashes/sha2_256.hpp>
 #include <nil/blueprint/hashes/sha2_512.hpp>
 
@@ -136,8 +144,10 @@ namespace nil {
                 currProverIdx(0),
                 assignment_ptr(std::make_shared<assignment<ArithmetizationType>>(desc)),
                 bp_ptr(std::make_shared<circuit<ArithmetizationType>>()),
+                scratch_ptr(std::make_shared<circuit<ArithmetizationType>>()),
                 assignments({assignment_proxy<ArithmetizationType>(assignment_ptr, currProverIdx)}),
                 circuits({circuit_proxy<ArithmetizationType>(bp_ptr, currProverIdx)}),
+                scratch_circuits({circuit_proxy<ArithmetizationType>(scratch_ptr, currProverIdx)}),
                 undef_var(put_constant_into_assignment(typename BlueprintFieldType::value_type(0))),
                 zero_var(undef_var),
                 one_var(put_constant_into_assignment(typename BlueprintFieldType::value_type(1))),
@@ -147,10 +157,12 @@ namespace nil {
                 log(log_level),
                 print_output_format(output_print_format),
                 validity_check(check_validity),
-                gen_mode(gen_mode)
+                gen_mode(gen_mode),
+                table_desc(desc),
+                stack_size(stack_size),
+                policy_kind(kind)
 
             {
-                detail::PolicyManager::set_policy(kind);
             }
 
             using ArithmetizationType = crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
@@ -159,6 +171,7 @@ namespace nil {
         private:
             std::uint32_t currProverIdx;
             std::shared_ptr<circuit<ArithmetizationType>> bp_ptr;
+            std::shared_ptr<circuit<ArithmetizationType>> scratch_ptr;
             std::shared_ptr<assignment<ArithmetizationType>> assignment_ptr;
 
         public:
@@ -166,6 +179,7 @@ namespace nil {
             std::vector<assignment_proxy<ArithmetizationType>> assignments;
 
         private:
+            std::vector<circuit_proxy<ArithmetizationType>> scratch_circuits;
 
             struct BranchDesc {
                     var cond;
@@ -226,9 +240,9 @@ namespace nil {
             template<typename map_type>
             void handle_scalar_cmp(const llvm::ICmpInst *inst, map_type &frame) {
                 llvm::CmpInst::Predicate p = inst->getPredicate();
-                const common_component_parameters param = {targetProverIdx, gen_mode};
+                const common_component_parameters param = component_parameters();
                 handle_comparison_component<BlueprintFieldType> (
-                    inst, frame, p, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                    inst, frame, ranges, p, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
             }
 
             void handle_vector_cmp(const llvm::ICmpInst *inst, stack_frame<var> &frame) {
@@ -245,13 +259,13 @@ namespace nil {
                     bitness = llvm::cast<llvm::IntegerType>(vector_ty->getElementType())->getBitWidth();
                 }
 
-                const common_component_parameters param = {targetProverIdx, gen_mode};
+                const common_component_parameters param = component_parameters();
                 for (size_t i = 0; i < lhs.size(); ++i) {
                     using eq_component_type = components::equality_flag<
                         crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>, BlueprintFieldType>;
                     auto v = handle_comparison_component_eq_neq<BlueprintFieldType, eq_component_type>(
                         inst->getPredicate(), lhs[i], rhs[i], bitness,
-                        circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                        current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
 
                     res.emplace_back(v.output);
                 }
@@ -274,11 +288,11 @@ namespace nil {
                 using eq_component_type = components::equality_flag<
                 crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>, BlueprintFieldType>;
 
-                const common_component_parameters param = {targetProverIdx, gen_mode};
+                const common_component_parameters param = component_parameters();
                 for (size_t i = 0; i < lhs.size(); ++i) {
                     auto v = handle_comparison_component_eq_neq<BlueprintFieldType, eq_component_type>(
                         inst->getPredicate(), lhs[i], rhs[i], 0,
-                        circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                        current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                     res.emplace_back(v.output);
                 }
 
@@ -288,7 +302,7 @@ namespace nil {
 
                 for (size_t i = 1; i < lhs.size(); ++i) {
                     are_curves_equal = handle_logic_and<BlueprintFieldType>(
-                        are_curves_equal, res[i], circuits[currProverIdx], assignments[currProverIdx], internal_storage,
+                        are_curves_equal, res[i], current_circuit(), assignments[currProverIdx], internal_storage,
                         statistics, param);
                 }
                 handle_result<BlueprintFieldType>
@@ -322,7 +336,7 @@ namespace nil {
 
             template <typename NumberType>
             NumberType resolve_number(var scalar) {
-                auto scalar_value = get_var_value(scalar);
+                auto scalar_value = get_layout_value(scalar);
                 static constexpr auto limit_value = typename BlueprintFieldType::integral_type(std::numeric_limits<NumberType>::max());
                 auto integral_value = static_cast<typename BlueprintFieldType::integral_type>(scalar_value.data);
                 ASSERT_MSG(integral_value < limit_value, "");
@@ -440,7 +454,7 @@ namespace nil {
                     }
                 }
 
-                const common_component_parameters param = {targetProverIdx, gen_mode};
+                const common_component_parameters param = component_parameters();
 
                 switch (id) {
                     case llvm::Intrinsic::assigner_malloc: {
@@ -453,7 +467,7 @@ namespace nil {
                         return true;
                     }
                     case llvm::Intrinsic::assigner_poseidon: {
-                        if constexpr (std::is_same<BlueprintFieldType, typename nil::crypto3::algebra::curves::pallas::base_field_type>::value) {
+                        if constexpr (detail::has_poseidon_parameters<BlueprintFieldType>::value) {
 
                             using component_type = components::poseidon<ArithmetizationType, BlueprintFieldType>;
 
@@ -466,25 +480,58 @@ namespace nil {
                             typename component_type::input_type instance_input = {input_state_var};
 
                             handle_component<BlueprintFieldType, component_type>
-                                    (circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param, instance_input, inst, frame);
+                                    (current_circuit(), assignments[currProverIdx], internal_storage, statistics, param, instance_input, inst, frame);
                             return true;
                         }
                         else {
                             UNREACHABLE("poseidon is implemented only for pallas native field");
                         }
                     }
+#ifdef ASSIGNER_EXTENDED_INTRINSICS
+                    case llvm::Intrinsic::assigner_poseidon_sponge: {
+                        handle_poseidon_sponge_component<BlueprintFieldType>(inst, frame, memory,
+                                                                             current_circuit(),
+                                                                             assignments[currProverIdx],
+                                                                             internal_storage,
+                                                                             statistics,
+                                                                             param);
+                        return true;
+                    }
+#endif
+#ifdef ASSIGNER_EXTENDED_INTRINSICS
+                    case llvm::Intrinsic::assigner_msm: {
+                        handle_curve_msm_component<BlueprintFieldType>(inst, frame, memory,
+                                                                       current_circuit(),
+                                                                       assignments[currProverIdx],
+                                                                       internal_storage,
+                                                                       statistics,
+                                                                       param);
+                        return true;
+                    }
+#endif
                     case llvm::Intrinsic::assigner_sha2_256: {
                         handle_sha2_256_component<BlueprintFieldType>(inst, frame,
-                                                                                             circuits[currProverIdx],
+                                                                                             current_circuit(),
                                                                                              assignments[currProverIdx],
                                                                                              internal_storage,
                                                                                              statistics,
                                                                                              param);
                         return true;
                     }
+#ifdef ASSIGNER_EXTENDED_INTRINSICS
+                    case llvm::Intrinsic::assigner_sha2_256_stream: {
+                        handle_sha2_256_stream_component<BlueprintFieldType>(inst, frame, memory,
+                                                                             current_circuit(),
+                                                                             assignments[currProverIdx],
+                                                                             internal_storage,
+                                                                             statistics,
+                                                                             param);
+                        return true;
+                    }
+#endif
                     case llvm::Intrinsic::assigner_sha2_512: {
                         if constexpr (std::is_same<BlueprintFieldType, typename nil::crypto3::algebra::curves::pallas::base_field_type>::value) {
-                            handle_sha2_512_component<BlueprintFieldType>(inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                            handle_sha2_512_component<BlueprintFieldType>(inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return true;
                         }
                         else {
@@ -494,7 +541,7 @@ namespace nil {
                     case llvm::Intrinsic::assigner_optimal_ate_pairing: {
                         if constexpr (std::is_same<BlueprintFieldType, typename nil::crypto3::algebra::fields::bls12_base_field<381>>::value) {
 
-                            handle_bls12381_pairing<BlueprintFieldType>(inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                            handle_bls12381_pairing<BlueprintFieldType>(inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return true;
                         }
                         else {
@@ -504,7 +551,7 @@ namespace nil {
                     case llvm::Intrinsic::assigner_hash_to_curve: {
                         if constexpr (std::is_same<BlueprintFieldType, typename nil::crypto3::algebra::fields::bls12_base_field<381>>::value) {
 
-                            handle_h2c<BlueprintFieldType>(inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                            handle_h2c<BlueprintFieldType>(inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return true;
                         }
                         else {
@@ -513,7 +560,7 @@ namespace nil {
                     }
                     case llvm::Intrinsic::assigner_is_in_g1_check: {
                         if constexpr (std::is_same<BlueprintFieldType, typename nil::crypto3::algebra::fields::bls12_base_field<381>>::value) {
-                            handle_is_in_g1<BlueprintFieldType>(inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                            handle_is_in_g1<BlueprintFieldType>(inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return true;
                         }
                         else {
@@ -522,7 +569,7 @@ namespace nil {
                     }
                     case llvm::Intrinsic::assigner_is_in_g2_check: {
                         if constexpr (std::is_same<BlueprintFieldType, typename nil::crypto3::algebra::fields::bls12_base_field<381>>::value) {
-                            handle_is_in_g2<BlueprintFieldType>(inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                            handle_is_in_g2<BlueprintFieldType>(inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return true;
                         }
                         else {
@@ -531,7 +578,7 @@ namespace nil {
                     }
                     case llvm::Intrinsic::assigner_gt_multiplication: {
                         if constexpr (std::is_same<BlueprintFieldType, typename nil::crypto3::algebra::fields::bls12_base_field<381>>::value) {
-                            handle_fp12_mul<BlueprintFieldType>(inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                            handle_fp12_mul<BlueprintFieldType>(inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return true;
                         }
                         else {
@@ -541,12 +588,12 @@ namespace nil {
                     case llvm::Intrinsic::assigner_bit_decomposition_field:
                     case llvm::Intrinsic::assigner_bit_decomposition: {
                         ASSERT(check_operands_constantness(inst, {1, 3}, frame));
-                        handle_integer_bit_decomposition_component<BlueprintFieldType>(inst, frame, memory, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                        handle_integer_bit_decomposition_component<BlueprintFieldType>(inst, frame, memory, ranges, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                         return true;
                     }
                     case llvm::Intrinsic::assigner_bit_composition: {
                         ASSERT(check_operands_constantness(inst, {1, 2}, frame));
-                        handle_integer_bit_composition_component<BlueprintFieldType>(inst, frame, memory, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                        handle_integer_bit_composition_component<BlueprintFieldType>(inst, frame, memory, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                         return true;
                     }
                     case llvm::Intrinsic::assigner_print_native_pallas_field: {
@@ -604,6 +651,13 @@ namespace nil {
                     case llvm::Intrinsic::assigner_exit_check: {
                         const var &logical_statement = frame.scalars[inst->getOperand(0)];
 
+                        if (gen_mode.has_fast_evaluation()) {
+                            if (get_var_value(logical_statement) == 0) {
+                                report_exit_check_failure(inst);
+                            }
+                            return true;
+                        }
+
                         std::size_t bitness = inst->getOperand(0)->getType()->getPrimitiveSizeInBits();
 
                         using eq_component_type = components::equality_flag<
@@ -611,7 +665,7 @@ namespace nil {
 
                         var comparison_result = handle_comparison_component_eq_neq<BlueprintFieldType, eq_component_type>(
                             llvm::CmpInst::ICMP_EQ, logical_statement, zero_var, bitness,
-                            circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param).output;
+                            current_circuit(), assignments[currProverIdx], internal_storage, statistics, param).output;
 
                         if (validity_check && gen_mode.has_assignments()) {
                             bool assigner_exit_check_input = get_var_value(comparison_result) == 0;
@@ -623,7 +677,7 @@ namespace nil {
                         handle_component_input<BlueprintFieldType, eq_component_type>(assignments[currProverIdx], instance_input, param);
                         const auto input_vars = instance_input.all_vars();
                         ASSERT(input_vars.size() == 2);
-                        circuits[currProverIdx].add_copy_constraint({input_vars[0].get(), input_vars[1].get()});
+                        current_circuit().add_copy_constraint({input_vars[0].get(), input_vars[1].get()});
 
                         return true;
                     }
@@ -632,6 +686,12 @@ namespace nil {
                         const var &x = frame.scalars[inst->getOperand(0)];
                         const var &y = frame.scalars[inst->getOperand(1)];
 
+                        if (gen_mode.has_fast_evaluation()) {
+                            if (get_var_value(x) != get_var_value(y)) {
+                                report_exit_check_failure(inst);
+                            }
+                            return true;
+                        }
 
                         if (validity_check && gen_mode.has_assignments()) {
                             bool exit_check_res = get_var_value(x) == get_var_value(y);
@@ -645,27 +705,27 @@ namespace nil {
                         handle_component_input<BlueprintFieldType, eq_component_type>(assignments[currProverIdx], instance_input, param);
                         const auto input_vars = instance_input.all_vars();
                         ASSERT(input_vars.size() == 2);
-                        circuits[currProverIdx].add_copy_constraint({input_vars[0].get(), input_vars[1].get()});
+                        current_circuit().add_copy_constraint({input_vars[0].get(), input_vars[1].get()});
 
                         return true;
                     }
                     case llvm::Intrinsic::assigner_fri_lin_inter: {
-                        handle_fri_lin_inter_component<BlueprintFieldType>(inst, frame, memory, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                        handle_fri_lin_inter_component<BlueprintFieldType>(inst, frame, memory, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                         return true;
                     }
                     case llvm::Intrinsic::assigner_fri_cosets: {
                         ASSERT_MSG(check_operands_constantness(inst, {1, 2}, frame), "result length, omega and total_bits must be constants");
-                        handle_fri_cosets_component<BlueprintFieldType>(inst, frame, memory, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                        handle_fri_cosets_component<BlueprintFieldType>(inst, frame, memory, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                         return true;
                     }
                     case llvm::Intrinsic::assigner_gate_arg_verifier: {
                         ASSERT_MSG(check_operands_constantness(inst, {1, 2, 4}, frame), "gates_sizes, gates and selectors amount must be constants");
-                        handle_gate_arg_verifier_component<BlueprintFieldType>(inst, frame, memory, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                        handle_gate_arg_verifier_component<BlueprintFieldType>(inst, frame, memory, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                         return true;
                     }
                     case llvm::Intrinsic::assigner_permutation_arg_verifier: {
                         ASSERT_MSG(check_operands_constantness(inst, {3}, frame), "f, se, sigma size must be constant");
-                        handle_permutation_arg_verifier_component<BlueprintFieldType>(inst, frame, memory, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                        handle_permutation_arg_verifier_component<BlueprintFieldType>(inst, frame, memory, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                         return true;
                     }
                     case llvm::Intrinsic::assigner_lookup_arg_verifier: {
@@ -673,12 +733,12 @@ namespace nil {
                         for (std::size_t i = 0; i < 8; i++) { constants_positions.push_back(i);}
                         for (std::size_t i = 4; i < 13; i++) { constants_positions.push_back(2*i + 1);}
                         ASSERT_MSG(check_operands_constantness(inst, constants_positions, frame), "vectors sizes must be constants");
-                        handle_lookup_arg_verifier_component<BlueprintFieldType>(inst, frame, memory, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                        handle_lookup_arg_verifier_component<BlueprintFieldType>(inst, frame, memory, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                         return true;
                     }
                     case llvm::Intrinsic::assigner_fri_array_swap: {
                         ASSERT_MSG(check_operands_constantness(inst, {1}, frame), "array size must be constant");
-                        handle_fri_array_swap_component<BlueprintFieldType>(inst, frame, memory, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                        handle_fri_array_swap_component<BlueprintFieldType>(inst, frame, memory, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                         return true;
                     }
 
@@ -693,7 +753,7 @@ namespace nil {
             void handle_store(ptr_type ptr, const llvm::Value *val, stack_frame<var> &frame) {
                 auto store_scalar = [this](ptr_type ptr, var v, size_t type_size) ->ptr_type {
                     auto &cell = memory[ptr];
-                    const common_component_parameters param = {targetProverIdx, gen_mode};
+                    const common_component_parameters param = component_parameters();
                     size_t cur_offset = cell.offset;
                     size_t cell_size = cell.size;
                     if (cell_size != type_size) {
@@ -758,13 +818,13 @@ namespace nil {
                                                    stack_frame<var> &frame,
                                                    llvm::Type *gep_ty) {
                 typename BlueprintFieldType::value_type base_ptr =
-                    get_var_value(frame.scalars[pointer_operand]);
+                    get_layout_value(frame.scalars[pointer_operand]);
                 auto base_ptr_number = resolve_number<ptr_type>(frame.scalars[pointer_operand]);
                 var gep_initial_idx = frame.scalars[initial_idx_operand];
                 ASSERT(gep_initial_idx.type == var::column_type::constant);
                 size_t cells_for_type = layout_resolver->get_cells_num<BlueprintFieldType>(gep_ty);
 
-                auto naive_ptr_adjustment = cells_for_type * get_var_value(gep_initial_idx);
+                auto naive_ptr_adjustment = cells_for_type * get_layout_value(gep_initial_idx);
                 auto adjusted_ptr = base_ptr + naive_ptr_adjustment;
                 if (adjusted_ptr == base_ptr) {
                     // The index is zero, the ptr remains unchanged
@@ -773,7 +833,7 @@ namespace nil {
                 int resolved_idx = 0;
                 // The index could be negative, so we need to take the difference with the modulus in this case
                 if (adjusted_ptr < base_ptr) {
-                    auto sub = BlueprintFieldType::modulus - static_cast<typename BlueprintFieldType::integral_type>(get_var_value(gep_initial_idx).data);
+                    auto sub = BlueprintFieldType::modulus - static_cast<typename BlueprintFieldType::integral_type>(get_layout_value(gep_initial_idx).data);
                     resolved_idx = static_cast<int>(sub) * -1;
                 } else {
                     resolved_idx = resolve_number<int>(gep_initial_idx);
@@ -953,6 +1013,27 @@ namespace nil {
                 }
             }
 
+            /**
+             * @brief Circuit of the current prover which components are generated into.
+             *
+             * Selectors of the assignment table need gate indices, so gates are generated in every mode.
+             * Without CIRCUIT mode they go to a scratch circuit which every evaluation starts anew, so a circuit
+             * generated or loaded before gets neither duplicated gates nor duplicated copy constraints.
+             */
+            circuit_proxy<ArithmetizationType> &current_circuit() {
+                return gen_mode.has_circuit() ? circuits[currProverIdx] : scratch_circuits[currProverIdx];
+            }
+
+            common_component_parameters component_parameters() const {
+                return {targetProverIdx, gen_mode, replay_steps.get(), witness_policy.get()};
+            }
+
+            void report_exit_check_failure(const llvm::Instruction *inst) {
+                exit_check_failures++;
+                LLVM_PRINT(inst, str);
+                std::cerr << "exit check failed: " << str << std::endl;
+            }
+
             void restore_state(const AssignerState& assigner_state) {
                 predecessor = assigner_state.predecessor;
                 currProverIdx = assigner_state.currProverIdx;
@@ -965,7 +1046,7 @@ namespace nil {
             void merge_memory_state(const memory_state<var>& state, const var& cond) {
                 auto stack_top = std::max(memory.get_stack_top(), state.stack_top);
                 auto heap_top = std::max(memory.get_heap_top(), state.heap_top);
-                const common_component_parameters param = {targetProverIdx, gen_mode};
+                const common_component_parameters param = component_parameters();
                 auto merge_region = [&cond, &param, &state, this](size_t memory_region_begin, size_t false_memory_region_end, size_t true_memory_region_end, bool is_stack) {
                     auto max_end = std::max(false_memory_region_end, true_memory_region_end); // max memory state and current memory used cells
                     // run throw all cells
@@ -977,11 +1058,11 @@ namespace nil {
                                 if (!detail::is_internal<var>(v_true) && !detail::is_internal<var>(v_false)) {
                                     // cell exist and contains real var in both state and current memory, so merged result = select(cond, state var, current memory var)
                                     memory.store(i, create_select_component<BlueprintFieldType, var>(
-                                                cond, v_true, v_false, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param, one_var));
+                                                cond, v_true, v_false, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param, one_var));
                                 } else {
                                     typename BlueprintFieldType::value_type res_value = 0;
                                     if (gen_mode.has_assignments()) {
-                                        res_value = (get_var_value(cond) != res_value) ? get_var_value(v_true) : get_var_value(v_false);
+                                        res_value = (get_layout_value(cond) != res_value) ? get_layout_value(v_true) : get_layout_value(v_false);
                                     }
                                     // cell exist in both state and current memory, but contains internal var, so merged result = internal var
                                     var internal_select_res = put_value_into_internal_storage(res_value);
@@ -1039,12 +1120,21 @@ namespace nil {
                     userProverIdx = currProverIdx;
                 }
 
+                // facts are proven in the table of the previous prover, the next one has to prove them again
+                if (userProverIdx != currProverIdx) {
+                    ranges.clear();
+                }
                 currProverIdx = userProverIdx;
 
                 if (currProverIdx >= assignments.size()) {
                     assignments.emplace_back(assignment_ptr, currProverIdx);
+                }
+                if (currProverIdx >= circuits.size()) {
                     circuits.emplace_back(bp_ptr, currProverIdx);
                 }
+                if (currProverIdx >= scratch_circuits.size()) {
+                    scratch_circuits.emplace_back(scratch_ptr, currProverIdx);
+                }
 
                 // Put constant operands to public input
                 for (int i = 0; i < inst->getNumOperands(); ++i) {
@@ -1057,33 +1147,54 @@ namespace nil {
                         frame.scalars[op] = globals[op];
                     } else if (llvm::isa<llvm::Constant>(op)) {
                         // We are replacing constant handling with passing them directly to a component
-                        // For now this functionality is supported only for intrinsics
+                        // For now this functionality is supported only for intrinsics and affine field operations
                         // In other cases the logic remains unchanged
-                        if (inst->getOpcode() != llvm::Instruction::Call ||
-                            !llvm::cast<llvm::CallInst>(inst)->getCalledFunction()->isIntrinsic()) {
+                        const bool by_value =
+                            (inst->getOpcode() == llvm::Instruction::Call &&
+                             llvm::cast<llvm::CallInst>(inst)->getCalledFunction()->isIntrinsic()) ||
+                            detail::takes_constant_operand_by_value<BlueprintFieldType>(inst, frame);
+                        if (!by_value) {
                             put_constant(llvm::cast<llvm::Constant>(op), frame);
                         }
                     }
                 }
 
-                const common_component_parameters param = {targetProverIdx, gen_mode};
+                const common_component_parameters param = component_parameters();
+
+                // Expression left by a previous evaluation of the instruction would shadow the new result
+                // if it is folded or placed by a component, PHI nodes replace it themselves
+                if (inst->getOpcode() != llvm::Instruction::PHI) {
+                    frame.linear_expressions.erase(inst);
+                }
+                // Pending linear expressions are placed into the circuit before any other use
+                if (!detail::keeps_linear_expressions(inst)) {
+                    for (int i = 0; i < inst->getNumOperands(); ++i) {
+                        detail::materialize_linear_operand<BlueprintFieldType>(
+                            inst->getOperand(i), frame, current_circuit(), assignments[currProverIdx],
+                            internal_storage, statistics, param);
+                    }
+                }
+
+                if (detail::fold_instruction<BlueprintFieldType>(inst, frame, assignments[currProverIdx], internal_storage)) {
+                    return inst->getNextNonDebugInstruction();
+                }
 
                 switch (inst->getOpcode()) {
                     case llvm::Instruction::Add: {
 
                         if (inst->getOperand(0)->getType()->isIntegerTy()) {
                             handle_integer_addition_component<BlueprintFieldType>(
-                                        inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                                        inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return inst->getNextNonDebugInstruction();
                         }
 
                         if (inst->getOperand(0)->getType()->isFieldTy() && inst->getOperand(1)->getType()->isFieldTy()) {
                             handle_field_addition_component<BlueprintFieldType>(
-                                        inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                                        inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return inst->getNextNonDebugInstruction();
                         } else if (inst->getOperand(0)->getType()->isCurveTy() && inst->getOperand(1)->getType()->isCurveTy()) {
                             handle_curve_addition_component<BlueprintFieldType>(
-                                        inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                                        inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return inst->getNextNonDebugInstruction();
                         } else {
                             UNREACHABLE("curve + scalar is undefined");
@@ -1094,17 +1205,17 @@ namespace nil {
                     case llvm::Instruction::Sub: {
                         if (inst->getOperand(0)->getType()->isIntegerTy()) {
                             handle_integer_subtraction_component<BlueprintFieldType>(
-                                inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                                inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return inst->getNextNonDebugInstruction();
                         }
 
                         if (inst->getOperand(0)->getType()->isFieldTy() && inst->getOperand(1)->getType()->isFieldTy()) {
                             handle_field_subtraction_component<BlueprintFieldType>(
-                                inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                                inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return inst->getNextNonDebugInstruction();
                         } else if (inst->getOperand(0)->getType()->isCurveTy() && inst->getOperand(1)->getType()->isCurveTy()) {
                             handle_curve_subtraction_component<BlueprintFieldType>(
-                                inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                                inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return inst->getNextNonDebugInstruction();
                         } else {
                             UNREACHABLE("curve - scalar is undefined");
@@ -1116,13 +1227,13 @@ namespace nil {
 
                         if (inst->getOperand(0)->getType()->isIntegerTy()) {
                             handle_integer_multiplication_component<BlueprintFieldType>(
-                                inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                                inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return inst->getNextNonDebugInstruction();
                         }
 
                         if (inst->getOperand(0)->getType()->isFieldTy() && inst->getOperand(1)->getType()->isFieldTy()) {
                             handle_field_multiplication_component<BlueprintFieldType>(
-                                inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                                inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return inst->getNextNonDebugInstruction();
                         }
 
@@ -1135,7 +1246,7 @@ namespace nil {
                             (inst->getOperand(0)->getType()->isCurveTy() && inst->getOperand(1)->getType()->isFieldTy()) ||
                             (inst->getOperand(1)->getType()->isCurveTy() && inst->getOperand(0)->getType()->isFieldTy())) {
                             handle_curve_multiplication_component<BlueprintFieldType>(
-                                inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                                inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return inst->getNextNonDebugInstruction();
                         } else {
                             UNREACHABLE("cmul opcode is defined only for curveTy * fieldTy");
@@ -1144,12 +1255,12 @@ namespace nil {
                     case llvm::Instruction::UDiv: {
                         if (inst->getOperand(0)->getType()->isIntegerTy() && inst->getOperand(1)->getType()->isIntegerTy()) {
                             handle_integer_division_remainder_component<BlueprintFieldType>(
-                                inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param, true);
+                                inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param, true);
                             return inst->getNextNonDebugInstruction();
                         }
                         else if (inst->getOperand(0)->getType()->isFieldTy() && inst->getOperand(1)->getType()->isFieldTy()) {
                             handle_field_division_component<BlueprintFieldType>(
-                                inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                                inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return inst->getNextNonDebugInstruction();
                         }
                         else {
@@ -1159,7 +1270,7 @@ namespace nil {
                     case llvm::Instruction::URem: {
                         if (inst->getOperand(0)->getType()->isIntegerTy() && inst->getOperand(1)->getType()->isIntegerTy()) {
                             handle_integer_division_remainder_component<BlueprintFieldType>(
-                                inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param, false);
+                                inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param, false);
                             return inst->getNextNonDebugInstruction();
                         } else {
                             UNREACHABLE("URem opcode is defined only for integerTy");
@@ -1167,8 +1278,8 @@ namespace nil {
                     }
                     case llvm::Instruction::Shl: {
                         if (inst->getOperand(0)->getType()->isIntegerTy() && inst->getOperand(1)->getType()->isIntegerTy()) {
-                            handle_integer_bit_shift_constant_component<BlueprintFieldType>(
-                                inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param,
+                            handle_integer_bit_shift_component<BlueprintFieldType>(
+                                inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param,
                                         nil::blueprint::components::bit_shift_mode::LEFT);
                             return inst->getNextNonDebugInstruction();
                         } else {
@@ -1177,8 +1288,8 @@ namespace nil {
                     }
                     case llvm::Instruction::LShr: {
                         if (inst->getOperand(0)->getType()->isIntegerTy() && inst->getOperand(1)->getType()->isIntegerTy()) {
-                            handle_integer_bit_shift_constant_component<BlueprintFieldType>(
-                                inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param,
+                            handle_integer_bit_shift_component<BlueprintFieldType>(
+                                inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param,
                                         nil::blueprint::components::bit_shift_mode::RIGHT);
                             return inst->getNextNonDebugInstruction();
                         } else {
@@ -1189,13 +1300,13 @@ namespace nil {
 
                         if (inst->getOperand(0)->getType()->isIntegerTy()) {
                             handle_integer_division_component<BlueprintFieldType>(
-                                inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                                inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return inst->getNextNonDebugInstruction();
                         }
 
                         if (inst->getOperand(0)->getType()->isFieldTy() && inst->getOperand(1)->getType()->isFieldTy()) {
                             handle_field_division_component<BlueprintFieldType>(
-                                inst, frame, circuits[currProverIdx], assignments[currProverIdx], internal_storage, statistics, param);
+                                inst, frame, current_circuit(), assignments[currProverIdx], internal_storage, statistics, param);
                             return inst->getNextNonDebugInstruction();
                         }
 
@@ -1265,10 +1376,20 @@ namespace nil {
                         return inst->getNextNonDebugInstruction();
                     }
                     case llvm::Instruction::Select: {
+                        if (gen_mode.has_fast_evaluation()) {
+                            const llvm::Value *chosen = get_var_value(variables[inst->getOperand(0)]) != 0 ?
+                                inst->getOperand(1) : inst->getOperand(2);
+                            if (variables.find(chosen) != variables.end()) {
+                                variables[inst] = variables[chosen];
+                            } else {
+                                frame.vectors[inst] = frame.vectors[chosen];
+                            }
+                            return inst->getNextNonDebugInstruction();
+                        }
                         handle_select_component<BlueprintFieldType>(
                             inst,
                             frame,
-                            circuits[currProverIdx],
+                            current_circuit(),
                             assignments[currProverIdx],
                             internal_storage,
                             statistics,
@@ -1281,7 +1402,7 @@ namespace nil {
                         handle_bitwise_and_component<BlueprintFieldType>(
                             inst,
                             frame,
-                            circuits[currProverIdx],
+                            current_circuit(),
                             assignments[currProverIdx],
                             internal_storage,
                             statistics,
@@ -1293,7 +1414,7 @@ namespace nil {
                         handle_bitwise_or_component<BlueprintFieldType>(
                             inst,
                             frame,
-                            circuits[currProverIdx],
+                            current_circuit(),
                             assignments[currProverIdx],
                             internal_storage,
                             statistics,
@@ -1305,7 +1426,7 @@ namespace nil {
                         handle_bitwise_xor_component<BlueprintFieldType>(
                             inst,
                             frame,
-                            circuits[currProverIdx],
+                            current_circuit(),
                             assignments[currProverIdx],
                             internal_storage,
                             statistics,
@@ -1329,9 +1450,12 @@ namespace nil {
                             if (metaDataNode) {
                                 UNREACHABLE("Can't to process loop");
                             }
+                            if (gen_mode.has_fast_evaluation()) {
+                                return &(get_var_value(cond) != 0 ? true_bb : false_bb)->front();
+                            }
                             const auto stack_size = call_stack.size();
                             if (gen_mode.has_assignments()) {
-                                bool cond_val = (get_var_value(cond) != 0);
+                                bool cond_val = (get_layout_value(cond) != 0);
                                 bool is_active_branch = (curr_branch.size() > 0) ? curr_branch.back().is_active_branch : true;
 
                                 const AssignerState assigner_state(*this);
@@ -1417,6 +1541,12 @@ namespace nil {
                         for (int i = 0; i < phi_node->getNumIncomingValues(); ++i) {
                             if (phi_node->getIncomingBlock(i) == predecessor) {
                                 llvm::Value *incoming_value = phi_node->getIncomingValue(i);
+                                auto pending = frame.linear_expressions.find(incoming_value);
+                                if (pending != frame.linear_expressions.end()) {
+                                    frame.linear_expressions[phi_node] = pending->second;
+                                    return phi_node->getNextNonDebugInstruction();
+                                }
+                                frame.linear_expressions.erase(phi_node);
                                 llvm::Type *value_type = incoming_value->getType();
                                 if (value_type->isIntegerTy() || value_type->isPointerTy() ||
                                     (value_type->isFieldTy() && field_arg_num<BlueprintFieldType>(value_type) == 1)) {
@@ -1442,7 +1572,7 @@ namespace nil {
                         unsigned bit_width = llvm::cast<llvm::IntegerType>(cond->getType())->getBitWidth();
                         ASSERT(bit_width <= 64);
                         if (gen_mode.has_assignments()) {
-                            auto cond_var = get_var_value(frame.scalars[cond]);
+                            auto cond_var = get_layout_value(frame.scalars[cond]);
                             auto cond_val = llvm::APInt(
                                 bit_width,
                                 (int64_t) static_cast<typename BlueprintFieldType::integral_type>(cond_var.data));
@@ -1737,6 +1867,16 @@ namespace nil {
                 return detail::var_value<BlueprintFieldType, var>(input_var, assignments[currProverIdx], internal_storage, gen_mode.has_assignments());
             }
 
+            /// @brief Value which decides layout of the table, a cell read is recorded as a guard of replay.
+            typename BlueprintFieldType::value_type get_layout_value(const var &input_var) {
+                const auto value = get_var_value(input_var);
+                if (replay_steps != nullptr && gen_mode.has_assignments() && !detail::is_internal<var>(input_var) &&
+                    input_var.type != var::column_type::constant) {
+                    replay_steps->guard(currProverIdx, input_var, value);
+                }
+                return value;
+            }
+
             /**
              * @brief Fill return value of the circuit function.
              *
@@ -1839,6 +1979,55 @@ namespace nil {
                 return true;
             }
 
+            /**
+             * @brief Limit witness columns used by components to `amount`, e.g. the one chosen by autotune.
+             *
+             * Components are limited to 15 witness columns by default whatever the table description is.
+             * The limit belongs to this assigner and applies to its evaluations started after the call.
+             */
+            void set_witness_limit(std::uint32_t amount) {
+                ASSERT_MSG(amount <= table_desc.witness_columns, "witness limit exceeds witness columns of the table");
+                witness_limit = amount;
+            }
+
+            std::string cache_key() const {
+                return circuit_cache::key<BlueprintFieldType>(*module, circuit_function->getName().str(), table_desc,
+                                                              policy_kind, witness_limit, maxNumProvers);
+            }
+
+            /**
+             * @brief Take the circuit from `cache_dir` if it was stored by a run with the same module and settings.
+             *
+             * Must be called after `parse_ir_file`. On success the loaded circuit gets its reserved lookup tables
+             * back and is not generated again: components place their gates into a scratch circuit, which only
+             * provides gate indices for selector columns. Gates used by each prover in the stored run are
+             * returned by `get_cached_usage`, evaluation fails if the scratch circuit disagrees with them.
+             */
+            bool load_cached_circuit(const std::string &cache_dir) {
+                const std::string key = cache_key();
+                if (!circuit_cache::load<BlueprintFieldType>(*bp_ptr, cached_usage, circuit_cache::path(cache_dir, key))) {
+                    return false;
+                }
+                gen_mode = gen_mode.without_circuit();
+                return true;
+            }
+
+            /// @brief Store the circuit generated by the finished evaluation in `cache_dir`, see `load_cached_circuit`.
+            bool store_circuit_in_cache(const std::string &cache_dir) {
+                ASSERT_MSG(finished && gen_mode.has_circuit(), "only a generated circuit can be stored");
+                const std::string key = cache_key();
+                std::vector<circuit_cache::usage> provers_usage;
+                for (const auto &proxy : circuits) {
+                    provers_usage.push_back(circuit_cache::usage::of(proxy));
+                }
+                return circuit_cache::store<BlueprintFieldType>(*bp_ptr, provers_usage, circuit_cache::path(cache_dir, key));
+            }
+
+            /// @brief Gates, copy constraints and lookup tables used by each prover, empty unless the circuit is cached.
+            const std::vector<circuit_cache::usage> &get_cached_usage() const {
+                return cached_usage;
+            }
+
             bool dump_public_input(const boost::json::array &public_input, const std::string &output_file) {
                 stack_frame<var> frame;
                 std::nullptr_t empty_assignmnt;
@@ -1862,6 +2051,31 @@ namespace nil {
                 const boost::json::array &public_input,
                 const boost::json::array &private_input
             ) {
+                json_array_source public_source(public_input);
+                json_array_source private_source(private_input);
+                return evaluate_inputs(public_source, private_source);
+            }
+
+            /**
+             * @brief Evaluate taking input files from streams, arguments are parsed one at a time.
+             *
+             * Memory is bounded by the largest argument, not by the input: each argument is parsed whole,
+             * so an input made of one huge array still takes its full JSON value.
+             */
+            bool evaluate(
+                std::istream &public_input,
+                std::istream &private_input
+            ) {
+                json_stream_source public_source(public_input);
+                json_stream_source private_source(private_input);
+                return evaluate_inputs(public_source, private_source);
+            }
+
+            template<typename PublicSource, typename PrivateSource>
+            bool evaluate_inputs(
+                PublicSource &public_input,
+                PrivateSource &private_input
+            ) {
 
                 stack_frame<var> base_frame;
                 auto &variables = base_frame.scalars;
@@ -1869,7 +2083,8 @@ namespace nil {
 
                 auto input_reader = InputReader<BlueprintFieldType, var, assignment_proxy<ArithmetizationType>>(
                     base_frame, memory, assignments[currProverIdx], *layout_resolver, internal_storage, gen_mode.has_assignments());
-                if (!input_reader.fill_public_input(*circuit_function, public_input, private_input, log)) {
+                input_reader.set_internal_inputs(gen_mode.has_fast_evaluation());
+                if (!input_reader.fill_arguments(*circuit_function, public_input, private_input, log)) {
                     std::cerr << "Public input does not match the circuit signature";
                     const std::string &error = input_reader.get_error();
                     if (!error.empty()) {
@@ -1878,6 +2093,303 @@ namespace nil {
                     std::cout << std::endl;
                     return false;
                 }
+                if (replay_steps != nullptr) {
+                    replay_layout = input_reader.get_argument_layout();
+                }
+                return run_circuit_function(std::move(base_frame));
+            }
+
+            /**
+             * @brief Prepare evaluation of the parsed circuit with another input set.
+             *
+             * Parsed module and type layouts are kept, the circuit stays as generated by the previous evaluation,
+             * everything which depends on the input is recreated: assignment table, memory, internal storage,
+             * frames, globals and range facts. Later evaluations fill the assignment table only.
+             */
+            void reset() {
+                currProverIdx = 0;
+                assignment_ptr = std::make_shared<assignment<ArithmetizationType>>(table_desc);
+                assignments.clear();
+                assignments.emplace_back(assignment_ptr, currProverIdx);
+                // Gates of the next evaluation must get the same indices as in the generated circuit
+                scratch_ptr = std::make_shared<circuit<ArithmetizationType>>();
+                scratch_circuits.clear();
+                scratch_circuits.emplace_back(scratch_ptr, currProverIdx);
+                undef_var = put_constant_into_assignment(typename BlueprintFieldType::value_type(0));
+                zero_var = undef_var;
+                one_var = put_constant_into_assignment(typename BlueprintFieldType::value_type(1));
+                memory = program_memory<var>(stack_size);
+                predecessor = nullptr;
+                call_stack = std::stack<stack_frame<var>>();
+                globals.clear();
+                labels.clear();
+                finished = false;
+                cpp_values.clear();
+                curr_branch.clear();
+                statistics = component_calls();
+                ranges.clear();
+                internal_storage.clear();
+                return_value.clear();
+                exit_check_failures = 0;
+                // Placement of the previous evaluation must not affect the next one
+                witness_policy.reset();
+                // Recorded steps refer to cells of the previous table
+                replay_steps.reset();
+                replay_layout.clear();
+                gen_mode = gen_mode.without_circuit();
+            }
+
+            /**
+             * @brief Evaluate the parsed circuit for a stream of input sets.
+             *
+             * `next_input` fills the public and private input of the next set and returns false when there are
+             * no more. The circuit is generated once, by the first evaluation, later ones leave it untouched.
+             * `on_assignment` is called with the index of the input set after each successful evaluation,
+             * `assignments` hold its table at this moment.
+             */
+            bool evaluate_batch(
+                const std::function<bool(boost::json::array &, boost::json::array &)> &next_input,
+                const std::function<void(std::size_t)> &on_assignment
+            ) {
+                boost::json::array public_input;
+                boost::json::array private_input;
+                for (std::size_t idx = 0; next_input(public_input, private_input); idx++) {
+                    if (idx > 0) {
+                        reset();
+                    }
+                    if (!evaluate(public_input, private_input)) {
+                        std::cerr << "Evaluation of input set " << idx << " failed" << std::endl;
+                        return false;
+                    }
+                    on_assignment(idx);
+                    public_input.clear();
+                    private_input.clear();
+                }
+                return true;
+            }
+
+            /**
+             * @brief Record witness generation steps of the next evaluation, see `replay_evaluation`.
+             *
+             * Must be called before `evaluate` with JSON input, not combined with FAST_EVALUATION mode.
+             */
+            void record_replay() {
+                ASSERT_MSG(!gen_mode.has_fast_evaluation(), "fast evaluation does not call components to record");
+                replay_steps = std::make_unique<replay_log<BlueprintFieldType>>();
+                replay_layout.clear();
+            }
+
+            /**
+             * @brief Fill the assignment table for new input without interpretation of the circuit.
+             *
+             * Input cells are overwritten with the new values, then the steps recorded by the previous
+             * evaluation (see `record_replay`) compute witnesses again in the same cells. The circuit is untouched.
+             *
+             * The result matches a full evaluation only if control flow and values computed outside of
+             * components (array indices, loop bounds, values folded into internal storage) do not depend on
+             * the changed input. Cells these values were read from are checked against the recorded evaluation,
+             * see replay_log.hpp, and replay is refused if one of them differs: the table is left partially
+             * replayed and a full evaluation is required. Printed output and the return value are not recomputed.
+             */
+            bool replay_evaluation(
+                const boost::json::array &public_input,
+                const boost::json::array &private_input
+            ) {
+                ASSERT_MSG(finished && replay_steps != nullptr, "replay requires a recorded evaluation");
+                stack_frame<var> frame;
+                program_memory<var> scratch_memory(stack_size);
+                column_type<BlueprintFieldType> scratch_storage;
+                auto input_reader = InputReader<BlueprintFieldType, var, assignment_proxy<ArithmetizationType>>(
+                    frame, scratch_memory, assignments[0], *layout_resolver, scratch_storage, true);
+                json_array_source public_source(public_input);
+                json_array_source private_source(private_input);
+                if (!input_reader.fill_arguments(*circuit_function, public_source, private_source, log)) {
+                    std::cerr << "Input does not match the circuit signature: " << input_reader.get_error()
+                              << std::endl;
+                    return false;
+                }
+                const auto &layout = input_reader.get_argument_layout();
+                bool layout_matches = layout.size() == replay_layout.size();
+                for (std::size_t i = 0; layout_matches && i < layout.size(); i++) {
+                    layout_matches = layout[i].is_private == replay_layout[i].is_private &&
+                                     layout[i].elements_amount == replay_layout[i].elements_amount;
+                }
+                if (!layout_matches) {
+                    std::cerr << "Input layout differs from the recorded evaluation, full evaluation is required"
+                              << std::endl;
+                    return false;
+                }
+                if (!replay_steps->replay(assignments)) {
+                    std::cerr << "Control flow or memory layout differs from the recorded evaluation, "
+                                 "full evaluation is required" << std::endl;
+                    return false;
+                }
+                return true;
+            }
+
+            /**
+             * @brief Evaluate taking input from a binary file, see binary_input.hpp.
+             *
+             * Arguments are laid out the same way as for values-free evaluation, then input cells are
+             * checked and loaded from the file in bulk.
+             */
+            bool evaluate(binary_input &input) {
+                stack_frame<var> base_frame;
+                base_frame.caller = nullptr;
+
+                auto input_reader = InputReader<BlueprintFieldType, var, assignment_proxy<ArithmetizationType>>(
+                    base_frame, memory, assignments[currProverIdx], *layout_resolver, internal_storage, false);
+                // Values-free layout of a string does not depend on its length, so circuits with
+                // string arguments are rejected by the layout check below
+                boost::json::array empty_input;
+                json_array_source empty_public_source(empty_input);
+                json_array_source empty_private_source(empty_input);
+                if (!input_reader.fill_arguments(*circuit_function, empty_public_source, empty_private_source, log)) {
+                    std::cerr << "Binary input does not match the circuit signature: " << input_reader.get_error()
+                              << std::endl;
+                    return false;
+                }
+                const auto &layout = input_reader.get_argument_layout();
+                const auto &arguments = input.get_arguments();
+                bool layout_matches = layout.size() == arguments.size() &&
+                    input.get_element_bytes() == binary_input::element_bytes_for<BlueprintFieldType>();
+                for (std::size_t i = 0; layout_matches && i < layout.size(); i++) {
+                    layout_matches = layout[i].is_private == arguments[i].is_private &&
+                                     layout[i].elements_amount == arguments[i].elements_amount;
+                }
+                if (!layout_matches) {
+                    std::cerr << "Binary input does not match the circuit signature" << std::endl;
+                    return false;
+                }
+                if (gen_mode.has_assignments()) {
+                    if (!input.check_values<BlueprintFieldType>(input_reader.get_int_elements())) {
+                        std::cerr << "Binary input is invalid: " << input.get_error() << std::endl;
+                        return false;
+                    }
+                    load_binary_input<BlueprintFieldType>(input, assignments[currProverIdx]);
+                }
+                return run_circuit_function(std::move(base_frame));
+            }
+
+            /// @brief Convert JSON input files of the circuit into a single binary input file.
+            bool dump_binary_input(const boost::json::array &public_input, const boost::json::array &private_input,
+                                   const std::string &output_file) {
+                stack_frame<var> frame;
+                binary_input_recorder<BlueprintFieldType> recorder;
+                auto input_reader = InputReader<BlueprintFieldType, var, binary_input_recorder<BlueprintFieldType>>(
+                    frame, memory, recorder, *layout_resolver, internal_storage, true);
+                if (!input_reader.fill_public_input(*circuit_function, public_input, private_input, log)) {
+                    std::cerr << "Input does not match the circuit signature: " << input_reader.get_error()
+                              << std::endl;
+                    return false;
+                }
+                if (!write_binary_input<BlueprintFieldType>(output_file, input_reader.get_argument_layout(),
+                                                            recorder.public_column, recorder.private_column)) {
+                    std::cerr << "Cannot write binary input file " << output_file << std::endl;
+                    return false;
+                }
+                return true;
+            }
+
+            /**
+             * @brief Get return value of circuit function.
+             *
+             * Returns undefined value if evaluation did not finished successfully.
+             *
+             * Non-native field/curve types are represented with single value and truncated to
+             * match the native size.
+             */
+            std::vector<typename BlueprintFieldType::integral_type> get_return_value() {
+                // TODO: this must be removed after completing implementation of `fill_return_value`
+                auto ret_type = circuit_function->getReturnType();
+                if (finished && !ret_type->isVoidTy() && return_value.empty()) {
+                    LLVM_PRINT(ret_type, str);
+                    TODO_WITH_LINK("accessing return value for " + str + " type",
+                                   "https://github.com/NilFoundation/zkllvm-assigner/issues/218");
+                }
+                return return_value;
+            }
+
+            /// @brief Amount of failed exit checks, they are counted in FAST_EVALUATION mode only.
+            std::size_t get_exit_check_failures() const {
+                return exit_check_failures;
+            }
+
+            /// @brief Print statistics at the end of evaluation in SIZE_ESTIMATION mode, enabled by default.
+            void set_print_statistics(bool enabled) {
+                print_statistics = enabled;
+            }
+
+            const component_calls &get_statistics() const {
+                return statistics;
+            }
+
+            /**
+             * @brief Get table dimensions measured by the evaluation in SIZE_ESTIMATION mode.
+             *
+             * The estimation is exact as long as the assigner which consumes it runs the same circuit
+             * with the same witness policy.
+             */
+            table_size_estimation get_table_size_estimation() {
+                ASSERT_MSG(gen_mode.has_size_estimation(), "table size is estimated in size estimation mode only");
+                table_size_estimation estimation;
+                estimation.rows_amount = std::max<std::size_t>(statistics.allocated_rows,
+                                                               assignments[0].allocated_rows());
+                estimation.constant_rows_amount = assignments[0].constant(1).size();
+                estimation.public_input_rows_amount = assignments[0].public_input(0).size();
+                estimation.internal_storage_size = internal_storage.size();
+                estimation.memory_cells_amount = memory.size();
+                return estimation;
+            }
+
+            /**
+             * @brief Reserve table columns, internal storage and memory according to the estimation.
+             *
+             * Must be called before `evaluate`. Neither column content nor amount of allocated rows is changed,
+             * columns just stop reallocating while the table grows.
+             */
+            void reserve_table(const table_size_estimation &estimation) {
+                using table_type = crypto3::zk::snark::plonk_assignment_table<BlueprintFieldType>;
+                using private_table_type = typename table_type::private_table_type;
+                using public_table_type = typename table_type::public_table_type;
+                const auto &table = *assignment_ptr;
+
+                // The table gives read-only access to whole columns, so they are rebuilt with reserved storage
+                std::vector<column_type<BlueprintFieldType>> witnesses;
+                for (std::uint32_t i = 0; i < table_desc.witness_columns; i++) {
+                    witnesses.push_back(detail::reserved_column(table.witness(i), estimation.rows_amount));
+                }
+                std::vector<column_type<BlueprintFieldType>> public_inputs;
+                for (std::uint32_t i = 0; i < table_desc.public_input_columns; i++) {
+                    public_inputs.push_back(detail::reserved_column(table.public_input(i),
+                                                                    estimation.public_input_rows_amount));
+                }
+                std::vector<column_type<BlueprintFieldType>> constants;
+                for (std::uint32_t i = 0; i < table_desc.constant_columns; i++) {
+                    // column 1 keeps constants of the circuit, other ones are filled by components
+                    constants.push_back(detail::reserved_column(
+                        table.constant(i), i == 1 ? estimation.constant_rows_amount : estimation.rows_amount));
+                }
+                std::vector<column_type<BlueprintFieldType>> selectors;
+                for (std::uint32_t i = 0; i < table_desc.selector_columns; i++) {
+                    selectors.push_back(detail::reserved_column(table.selector(i), estimation.rows_amount));
+                }
+                // Only columns are replaced, rows counter and shared columns of the assignment stay as they are
+                static_cast<table_type &>(*assignment_ptr) = table_type(
+                    private_table_type(std::move(witnesses)),
+                    public_table_type(std::move(public_inputs), std::move(constants), std::move(selectors)));
+
+                internal_storage.reserve(estimation.internal_storage_size);
+                memory.reserve(estimation.memory_cells_amount);
+            }
+
+        private:
+            bool run_circuit_function(stack_frame<var> &&base_frame) {
+                // Policy keeps track of placed components, so each evaluation starts with a fresh one
+                witness_policy = detail::PolicyManager::make_policy(policy_kind, witness_limit);
+                if (witness_policy == nullptr) {
+                    return false;
+                }
                 call_stack.emplace(std::move(base_frame));
 
                 // Collect all the possible labels that could be an argument in IndirectBrInst
@@ -1909,8 +2421,17 @@ namespace nil {
                 const llvm::Instruction *next_inst = &circuit_function->begin()->front();
                 while (true) {
                     next_inst = handle_instruction(next_inst);
+                    if (!witness_policy->get_error().empty()) {
+                        std::cerr << "Witness policy \"" << policy_kind << "\" is violated: "
+                                  << witness_policy->get_error() << std::endl;
+                        return false;
+                    }
                     if (finished) {
-                        if (gen_mode.has_size_estimation()) {
+                        if (!cached_usage.empty() && !gen_mode.has_fast_evaluation() && !matches_cached_circuit()) {
+                            std::cerr << "Cached circuit does not match the evaluation" << std::endl;
+                            return false;
+                        }
+                        if (gen_mode.has_size_estimation() && print_statistics) {
                             std::cout << "\nallocated_rows: " <<  assignments[currProverIdx].allocated_rows() << "\n";
                             statistics.print();
                         }
@@ -1922,26 +2443,18 @@ namespace nil {
                 }
             }
 
-            /**
-             * @brief Get return value of circuit function.
-             *
-             * Returns undefined value if evaluation did not finished successfully.
-             *
-             * Non-native field/curve types are represented with single value and truncated to
-             * match the native size.
-             */
-            std::vector<typename BlueprintFieldType::integral_type> get_return_value() {
-                // TODO: this must be removed after completing implementation of `fill_return_value`
-                auto ret_type = circuit_function->getReturnType();
-                if (finished && !ret_type->isVoidTy() && return_value.empty()) {
-                    LLVM_PRINT(ret_type, str);
-                    TODO_WITH_LINK("accessing return value for " + str + " type",
-                                   "https://github.com/NilFoundation/zkllvm-assigner/issues/218");
+            bool matches_cached_circuit() const {
+                if (scratch_circuits.size() != cached_usage.size()) {
+                    return false;
                 }
-                return return_value;
+                for (std::size_t i = 0; i < cached_usage.size(); i++) {
+                    if (circuit_cache::usage::of(scratch_circuits[i]) != cached_usage[i]) {
+                        return false;
+                    }
+                }
+                return true;
             }
 
-        private:
             var undef_var;
             var zero_var;
             var one_var;
@@ -1951,6 +2464,7 @@ namespace nil {
             logger log;
             print_format print_output_format = no_print;
             bool validity_check;
+            bool print_statistics = true;
             generation_mode gen_mode;
             llvm::LLVMContext context;
             const llvm::BasicBlock *predecessor = nullptr;
@@ -1964,12 +2478,22 @@ namespace nil {
             std::vector<const void *> cpp_values;
             std::vector<BranchDesc> curr_branch;
             component_calls statistics;
+            range_facts<var> ranges;
             /***
              * extention of assignment table for keep internal values which not presented in components
              * identified as constant column with special internal_storage_index = std::numeric_limits<std::size_t>::max()
             ***/
             column_type<BlueprintFieldType> internal_storage;
             std::vector<typename BlueprintFieldType::integral_type> return_value;
+            std::size_t exit_check_failures = 0;
+            std::unique_ptr<replay_log<BlueprintFieldType>> replay_steps;
+            std::vector<binary_input::argument> replay_layout;
+            std::vector<circuit_cache::usage> cached_usage;
+            crypto3::zk::snark::plonk_table_description<BlueprintFieldType> table_desc;
+            long stack_size;
+            std::string policy_kind;
+            std::uint32_t witness_limit = detail::CompilerRestrictions::default_witness_amount;
+            std::unique_ptr<detail::Policy> witness_policy;
         };
 
     }     // namespace blueprint
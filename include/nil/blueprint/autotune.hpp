@@ -0,0 +1,269 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_AUTOTUNE_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_AUTOTUNE_HPP_
+
+#include <algorithm>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <boost/json/array.hpp>
+
+#include <nil/blueprint/assigner.hpp>
+#include <nil/blueprint/policy/policy.hpp>
+
+namespace nil {
+    namespace blueprint {
+
+        struct autotune_config {
+            std::vector<std::uint32_t> witness_limits = {9, 10, 11, 12, 13, 14, 15};
+            std::vector<std::string> policies = {"default", "min_rows", "packing"};
+            std::uint32_t max_num_provers = 1;
+            // amount of size estimations running simultaneously, hardware concurrency if zero
+            std::size_t jobs = 0;
+        };
+
+        /// @brief Result of size estimation with particular witness columns limit and policy.
+        struct autotune_candidate {
+            std::uint32_t witness_limit;
+            std::string policy;
+            bool succeeded = false;
+            std::size_t rows_amount = 0;
+            std::size_t padded_rows_amount = 0;
+            std::size_t gates_amount = 0;
+        };
+
+        /**
+         * @brief Candidates preference: succeeded ones first, then the least padded rows,
+         * which define prover time, then the least witness columns and gates.
+         */
+        inline bool autotune_better(const autotune_candidate &a, const autotune_candidate &b) {
+            return std::make_tuple(!a.succeeded, a.padded_rows_amount, a.witness_limit, a.gates_amount) <
+                   std::make_tuple(!b.succeeded, b.padded_rows_amount, b.witness_limit, b.gates_amount);
+        }
+
+        namespace detail {
+            template<typename BlueprintFieldType>
+            autotune_candidate estimate_candidate(
+                const char *ir_file,
+                crypto3::zk::snark::plonk_table_description<BlueprintFieldType> desc,
+                long stack_size,
+                const boost::json::array &public_input,
+                const boost::json::array &private_input,
+                std::uint32_t max_num_provers,
+                std::uint32_t witness_limit,
+                const std::string &policy) {
+
+                autotune_candidate candidate;
+                candidate.witness_limit = witness_limit;
+                candidate.policy = policy;
+
+                desc.witness_columns = witness_limit;
+                assigner<BlueprintFieldType> estimator(desc, stack_size, boost::log::trivial::warning, max_num_provers,
+                                                       std::numeric_limits<std::uint32_t>::max(),
+                                                       generation_mode::size_estimation(), policy);
+                estimator.set_witness_limit(witness_limit);
+                estimator.set_print_statistics(false);
+                if (!estimator.parse_ir_file(ir_file) || !estimator.evaluate(public_input, private_input)) {
+                    return candidate;
+                }
+
+                const auto table_size = estimator.get_table_size_estimation();
+                candidate.succeeded = true;
+                candidate.rows_amount = std::max({table_size.rows_amount, table_size.constant_rows_amount,
+                                                  table_size.public_input_rows_amount});
+                candidate.padded_rows_amount = padded_rows_amount(candidate.rows_amount);
+                candidate.gates_amount = estimator.get_statistics().total_gates();
+                return candidate;
+            }
+
+            struct estimation_message {
+                bool succeeded;
+                std::size_t rows_amount;
+                std::size_t padded_rows_amount;
+                std::size_t gates_amount;
+            };
+
+            /// @brief Run size estimation in a child process, returns its pid and the pipe to read result from.
+            template<typename BlueprintFieldType>
+            std::pair<pid_t, int> spawn_estimation(
+                const char *ir_file,
+                const crypto3::zk::snark::plonk_table_description<BlueprintFieldType> &desc,
+                long stack_size,
+                const boost::json::array &public_input,
+                const boost::json::array &private_input,
+                std::uint32_t max_num_provers,
+                std::uint32_t witness_limit,
+                const std::string &policy) {
+
+                int fds[2];
+                ASSERT_MSG(pipe(fds) == 0, "failed to create a pipe for size estimation");
+                const pid_t pid = fork();
+                ASSERT_MSG(pid >= 0, "failed to fork size estimation");
+                if (pid == 0) {
+                    close(fds[0]);
+                    const auto candidate = estimate_candidate<BlueprintFieldType>(
+                        ir_file, desc, stack_size, public_input, private_input, max_num_provers, witness_limit, policy);
+                    const estimation_message message = {candidate.succeeded, candidate.rows_amount,
+                                                        candidate.padded_rows_amount, candidate.gates_amount};
+                    const bool written = write(fds[1], &message, sizeof(message)) == sizeof(message);
+                    close(fds[1]);
+                    _exit(written ? 0 : 1);
+                }
+                close(fds[1]);
+                return {pid, fds[0]};
+            }
+
+            inline autotune_candidate wait_estimation(std::pair<pid_t, int> estimation,
+                                                      std::uint32_t witness_limit, const std::string &policy) {
+                autotune_candidate candidate;
+                candidate.witness_limit = witness_limit;
+                candidate.policy = policy;
+
+                estimation_message message;
+                // a process aborted by an assertion writes nothing
+                if (read(estimation.second, &message, sizeof(message)) == sizeof(message)) {
+                    candidate.succeeded = message.succeeded;
+                    candidate.rows_amount = message.rows_amount;
+                    candidate.padded_rows_amount = message.padded_rows_amount;
+                    candidate.gates_amount = message.gates_amount;
+                }
+                close(estimation.second);
+                waitpid(estimation.first, nullptr, 0);
+                return candidate;
+            }
+        }    // namespace detail
+
+        /**
+         * @brief Run size estimation of the circuit for every pair of witness limit and policy.
+         *
+         * Estimations are independent assigner runs, `config.jobs` of them are evaluated in parallel.
+         * Every run is a separate process since a configuration may be rejected by an assertion,
+         * e.g. when a component does not fit into the witness limit.
+         * Candidates are returned in the order of preference, see `autotune_better`. Autotune only estimates,
+         * the circuit is generated afterwards by `evaluate_candidate(candidates.front(), ...)`.
+         */
+        template<typename BlueprintFieldType>
+        std::vector<autotune_candidate> autotune(
+            const char *ir_file,
+            const crypto3::zk::snark::plonk_table_description<BlueprintFieldType> &desc,
+            long stack_size,
+            const boost::json::array &public_input,
+            const boost::json::array &private_input,
+            const autotune_config &config = autotune_config()) {
+
+            std::vector<std::pair<std::uint32_t, std::string>> configurations;
+            for (const auto witness_limit : config.witness_limits) {
+                for (const auto &policy : config.policies) {
+                    configurations.emplace_back(witness_limit, policy);
+                }
+            }
+
+            const std::size_t jobs = config.jobs != 0 ? config.jobs : std::max(1u, std::thread::hardware_concurrency());
+            std::vector<autotune_candidate> candidates;
+            for (std::size_t first = 0; first < configurations.size(); first += jobs) {
+                const std::size_t last = std::min(first + jobs, configurations.size());
+                std::vector<std::pair<pid_t, int>> running;
+                std::cout.flush();
+                std::cerr.flush();
+                for (std::size_t i = first; i < last; i++) {
+                    running.push_back(detail::spawn_estimation<BlueprintFieldType>(
+                        ir_file, desc, stack_size, public_input, private_input, config.max_num_provers,
+                        configurations[i].first, configurations[i].second));
+                }
+                for (std::size_t i = first; i < last; i++) {
+                    candidates.push_back(detail::wait_estimation(running[i - first],
+                                                                 configurations[i].first, configurations[i].second));
+                }
+            }
+
+            std::stable_sort(candidates.begin(), candidates.end(), autotune_better);
+            return candidates;
+        }
+
+        /**
+         * @brief Generate the circuit with the witness limit and policy of `candidate`, usually the first one
+         * returned by `autotune`.
+         *
+         * The table gets `candidate.witness_limit` witness columns, other columns are taken from `desc`.
+         * Returns the assigner holding circuits and assignments, or nullptr if the candidate failed
+         * its estimation or the evaluation fails.
+         */
+        template<typename BlueprintFieldType>
+        std::unique_ptr<assigner<BlueprintFieldType>> evaluate_candidate(
+            const autotune_candidate &candidate,
+            const char *ir_file,
+            crypto3::zk::snark::plonk_table_description<BlueprintFieldType> desc,
+            long stack_size,
+            const boost::json::array &public_input,
+            const boost::json::array &private_input,
+            std::uint32_t max_num_provers = 1,
+            std::uint32_t target_prover_idx = std::numeric_limits<std::uint32_t>::max(),
+            generation_mode gen_mode = generation_mode::circuit() | generation_mode::assignments(),
+            boost::log::trivial::severity_level log_level = boost::log::trivial::info) {
+
+            if (!candidate.succeeded) {
+                return nullptr;
+            }
+            desc.witness_columns = candidate.witness_limit;
+            auto result = std::make_unique<assigner<BlueprintFieldType>>(
+                desc, stack_size, log_level, max_num_provers, target_prover_idx, gen_mode, candidate.policy);
+            result->set_witness_limit(candidate.witness_limit);
+            if (!result->parse_ir_file(ir_file) || !result->evaluate(public_input, private_input)) {
+                return nullptr;
+            }
+            return result;
+        }
+
+        inline void print_autotune_report(const std::vector<autotune_candidate> &candidates, std::ostream &out) {
+            out << "================\n";
+            out << "autotune:\n";
+            for (const auto &candidate : candidates) {
+                out << "witness limit: " << candidate.witness_limit << ", policy: " << candidate.policy;
+                if (!candidate.succeeded) {
+                    out << " - failed\n";
+                    continue;
+                }
+                out << ", rows: " << candidate.rows_amount << " (" << candidate.padded_rows_amount << " padded)"
+                    << ", gates: " << candidate.gates_amount << "\n";
+            }
+            if (!candidates.empty() && candidates.front().succeeded) {
+                out << "best: witness limit " << candidates.front().witness_limit
+                    << ", policy " << candidates.front().policy << "\n";
+            }
+            out << std::endl;
+        }
+    }     // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_AUTOTUNE_HPP_
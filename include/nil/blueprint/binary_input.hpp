@@ -0,0 +1,379 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_BINARY_INPUT_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_BINARY_INPUT_HPP_
+
+#include <nil/blueprint/asserts.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace nil {
+    namespace blueprint {
+
+        namespace detail {
+            /// @brief Element as it is stored, elements are not reduced modulo the field modulus.
+            template<typename BlueprintFieldType>
+            typename BlueprintFieldType::extended_integral_type read_binary_number(const unsigned char *data,
+                                                                                   std::size_t element_bytes) {
+                typename BlueprintFieldType::extended_integral_type value = 0;
+                for (std::size_t i = element_bytes; i > 0; i--) {
+                    value <<= 8;
+                    value |= data[i - 1];
+                }
+                return value;
+            }
+
+            template<typename BlueprintFieldType>
+            typename BlueprintFieldType::value_type read_binary_element(const unsigned char *data,
+                                                                        std::size_t element_bytes) {
+                return typename BlueprintFieldType::integral_type(
+                    read_binary_number<BlueprintFieldType>(data, element_bytes));
+            }
+        }    // namespace detail
+
+        /**
+         * @brief Binary input file, an alternative to the pair of JSON input files.
+         *
+         * Keeps exactly the cells which `InputReader` puts into the public input column and the private storage,
+         * so loading needs neither JSON nor decimal parsing nor chopping of non-native elements.
+         * All numbers are little-endian:
+         *
+         *     char[4]  magic "ZKBI"
+         *     u32      format version
+         *     u32      bytes per element
+         *     u32      arguments amount
+         *     u64      public elements amount
+         *     u64      private elements amount
+         *     arguments amount times:
+         *         u32  1 for [[private_input]] argument, 0 otherwise
+         *         u64  elements amount of the argument
+         *     public elements, then private elements
+         *
+         * The file is mapped into memory, elements are decoded straight from the mapping.
+         */
+        class binary_input {
+        public:
+            struct argument {
+                bool is_private;
+                std::uint64_t elements_amount;
+            };
+
+            /// @brief Element of an integer argument, it must fit into `bitness` bits.
+            struct int_element {
+                bool is_private;
+                std::size_t idx;
+                std::size_t bitness;
+            };
+
+            static constexpr char magic[4] = {'Z', 'K', 'B', 'I'};
+            static constexpr std::uint32_t version = 1;
+
+            template<typename BlueprintFieldType>
+            static constexpr std::uint32_t element_bytes_for() {
+                return (BlueprintFieldType::modulus_bits + 7) / 8;
+            }
+
+            binary_input() = default;
+            binary_input(const binary_input &) = delete;
+            binary_input &operator=(const binary_input &) = delete;
+
+            ~binary_input() {
+                close();
+            }
+
+            bool open(const std::string &path) {
+                close();
+                int fd = ::open(path.c_str(), O_RDONLY);
+                if (fd < 0) {
+                    error = "cannot open binary input file " + path;
+                    return false;
+                }
+                struct stat file_stat;
+                if (fstat(fd, &file_stat) != 0) {
+                    ::close(fd);
+                    error = "cannot get size of binary input file " + path;
+                    return false;
+                }
+                if (file_stat.st_size == 0) {
+                    ::close(fd);
+                    error = "binary input file " + path + " is empty";
+                    return false;
+                }
+                mapping_size = file_stat.st_size;
+                void *mapped = mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                // The mapping stays valid after the descriptor is closed
+                ::close(fd);
+                if (mapped == MAP_FAILED) {
+                    mapping_size = 0;
+                    error = "cannot map binary input file " + path;
+                    return false;
+                }
+                mapping = static_cast<const unsigned char *>(mapped);
+                madvise(mapped, mapping_size, MADV_SEQUENTIAL);
+                return parse_header();
+            }
+
+            void close() {
+                if (mapping != nullptr) {
+                    munmap(const_cast<unsigned char *>(mapping), mapping_size);
+                }
+                mapping = nullptr;
+                mapping_size = 0;
+                arguments.clear();
+            }
+
+            const std::vector<argument> &get_arguments() const {
+                return arguments;
+            }
+
+            std::uint32_t get_element_bytes() const {
+                return element_bytes;
+            }
+
+            std::size_t public_amount() const {
+                return public_elements_amount;
+            }
+
+            std::size_t private_amount() const {
+                return private_elements_amount;
+            }
+
+            template<typename BlueprintFieldType>
+            typename BlueprintFieldType::value_type public_element(std::size_t idx) const {
+                ASSERT(idx < public_elements_amount);
+                return read_element<BlueprintFieldType>(elements + idx * element_bytes);
+            }
+
+            template<typename BlueprintFieldType>
+            typename BlueprintFieldType::value_type private_element(std::size_t idx) const {
+                ASSERT(idx < private_elements_amount);
+                return read_element<BlueprintFieldType>(elements + (public_elements_amount + idx) * element_bytes);
+            }
+
+            /**
+             * @brief Checks the values the same way `InputReader` checks JSON input: every element must be
+             * below the field modulus and every element of an integer argument must fit into its bitness.
+             */
+            template<typename BlueprintFieldType>
+            bool check_values(const std::vector<int_element> &int_elements) {
+                using extended_integral_type = typename BlueprintFieldType::extended_integral_type;
+
+                const extended_integral_type modulus = BlueprintFieldType::modulus;
+                for (std::size_t i = 0; i < public_elements_amount + private_elements_amount; i++) {
+                    if (detail::read_binary_number<BlueprintFieldType>(elements + i * element_bytes, element_bytes) >=
+                            modulus) {
+                        error = "binary input element " + std::to_string(i) + " is not below the field modulus";
+                        return false;
+                    }
+                }
+                for (const auto &element : int_elements) {
+                    const std::size_t idx = element.is_private ? public_elements_amount + element.idx : element.idx;
+                    ASSERT(idx < public_elements_amount + private_elements_amount);
+                    const extended_integral_type value =
+                        detail::read_binary_number<BlueprintFieldType>(elements + idx * element_bytes, element_bytes);
+                    if (value >> element.bitness != 0) {
+                        error = "binary input element " + std::to_string(idx) + " does not fit into " +
+                                std::to_string(element.bitness) + " bits";
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            const std::string &get_error() const {
+                return error;
+            }
+
+        private:
+            template<typename BlueprintFieldType>
+            typename BlueprintFieldType::value_type read_element(const unsigned char *data) const {
+                return detail::read_binary_element<BlueprintFieldType>(data, element_bytes);
+            }
+
+            template<typename T>
+            bool read_number(std::size_t &offset, T &out) {
+                if (mapping_size - offset < sizeof(T)) {
+                    error = "binary input file is truncated";
+                    return false;
+                }
+                out = 0;
+                for (std::size_t i = 0; i < sizeof(T); i++) {
+                    out |= T(mapping[offset + i]) << (8 * i);
+                }
+                offset += sizeof(T);
+                return true;
+            }
+
+            bool parse_header() {
+                if (mapping_size < sizeof(magic) || std::memcmp(mapping, magic, sizeof(magic)) != 0) {
+                    error = "binary input file has wrong magic";
+                    return false;
+                }
+                std::size_t offset = sizeof(magic);
+                std::uint32_t file_version;
+                std::uint32_t arguments_amount;
+                std::uint64_t public_amount;
+                std::uint64_t private_amount;
+                if (!read_number(offset, file_version) || !read_number(offset, element_bytes) ||
+                    !read_number(offset, arguments_amount) || !read_number(offset, public_amount) ||
+                    !read_number(offset, private_amount)) {
+                    return false;
+                }
+                if (file_version != version) {
+                    error = "unsupported binary input version " + std::to_string(file_version);
+                    return false;
+                }
+                std::uint64_t public_sum = 0;
+                std::uint64_t private_sum = 0;
+                arguments.reserve(arguments_amount);
+                for (std::uint32_t i = 0; i < arguments_amount; i++) {
+                    std::uint32_t is_private;
+                    std::uint64_t elements_amount;
+                    if (!read_number(offset, is_private) || !read_number(offset, elements_amount)) {
+                        return false;
+                    }
+                    arguments.push_back({is_private != 0, elements_amount});
+                    (is_private != 0 ? private_sum : public_sum) += elements_amount;
+                }
+                if (public_sum != public_amount || private_sum != private_amount) {
+                    error = "binary input file arguments do not match elements amount";
+                    return false;
+                }
+                if ((mapping_size - offset) / element_bytes < public_amount + private_amount) {
+                    error = "binary input file is truncated";
+                    return false;
+                }
+                public_elements_amount = public_amount;
+                private_elements_amount = private_amount;
+                elements = mapping + offset;
+                return true;
+            }
+
+            const unsigned char *mapping = nullptr;
+            std::size_t mapping_size = 0;
+            const unsigned char *elements = nullptr;
+            std::uint32_t element_bytes = 0;
+            std::size_t public_elements_amount = 0;
+            std::size_t private_elements_amount = 0;
+            std::vector<argument> arguments;
+            std::string error;
+        };
+
+        /// @brief Assignment stand-in for `InputReader` which only records input cells, used for conversion.
+        template<typename BlueprintFieldType>
+        struct binary_input_recorder {
+            static constexpr std::uint32_t private_storage_index = std::numeric_limits<std::uint32_t>::max();
+
+            typename BlueprintFieldType::value_type &public_input(std::uint32_t, std::size_t row) {
+                if (row >= public_column.size()) {
+                    public_column.resize(row + 1);
+                }
+                return public_column[row];
+            }
+
+            typename BlueprintFieldType::value_type &private_storage(std::size_t row) {
+                if (row >= private_column.size()) {
+                    private_column.resize(row + 1);
+                }
+                return private_column[row];
+            }
+
+            std::vector<typename BlueprintFieldType::value_type> public_column;
+            std::vector<typename BlueprintFieldType::value_type> private_column;
+        };
+
+        namespace detail {
+            template<typename T>
+            void write_binary_number(std::ostream &out, T value) {
+                for (std::size_t i = 0; i < sizeof(T); i++) {
+                    out.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+                }
+            }
+
+            template<typename BlueprintFieldType>
+            void write_binary_elements(std::ostream &out,
+                                       const std::vector<typename BlueprintFieldType::value_type> &elements) {
+                constexpr std::uint32_t element_bytes = binary_input::element_bytes_for<BlueprintFieldType>();
+                std::vector<char> buffer(element_bytes);
+                for (const auto &element : elements) {
+                    typename BlueprintFieldType::integral_type value = typename BlueprintFieldType::integral_type(element.data);
+                    for (std::size_t i = 0; i < element_bytes; i++) {
+                        buffer[i] = static_cast<char>(static_cast<unsigned>(value & 0xFF));
+                        value >>= 8;
+                    }
+                    out.write(buffer.data(), element_bytes);
+                }
+            }
+        }    // namespace detail
+
+        template<typename BlueprintFieldType>
+        bool write_binary_input(const std::string &output_file,
+                                const std::vector<binary_input::argument> &arguments,
+                                const std::vector<typename BlueprintFieldType::value_type> &public_elements,
+                                const std::vector<typename BlueprintFieldType::value_type> &private_elements) {
+            std::ofstream out(output_file, std::ios::binary);
+            if (!out) {
+                return false;
+            }
+            out.write(binary_input::magic, sizeof(binary_input::magic));
+            detail::write_binary_number<std::uint32_t>(out, binary_input::version);
+            detail::write_binary_number<std::uint32_t>(out, binary_input::element_bytes_for<BlueprintFieldType>());
+            detail::write_binary_number<std::uint32_t>(out, arguments.size());
+            detail::write_binary_number<std::uint64_t>(out, public_elements.size());
+            detail::write_binary_number<std::uint64_t>(out, private_elements.size());
+            for (const auto &arg : arguments) {
+                detail::write_binary_number<std::uint32_t>(out, arg.is_private ? 1 : 0);
+                detail::write_binary_number<std::uint64_t>(out, arg.elements_amount);
+            }
+            detail::write_binary_elements<BlueprintFieldType>(out, public_elements);
+            detail::write_binary_elements<BlueprintFieldType>(out, private_elements);
+            return static_cast<bool>(out);
+        }
+
+        /// @brief Bulk load of the elements into the public input column and the private storage.
+        template<typename BlueprintFieldType, typename Assignment>
+        void load_binary_input(const binary_input &input, Assignment &assignment) {
+            for (std::size_t i = 0; i < input.public_amount(); i++) {
+                assignment.public_input(0, i) = input.public_element<BlueprintFieldType>(i);
+            }
+            for (std::size_t i = 0; i < input.private_amount(); i++) {
+                assignment.private_storage(i) = input.private_element<BlueprintFieldType>(i);
+            }
+        }
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_BINARY_INPUT_HPP_
@@ -50,15 +50,17 @@ namespace nil {
 
                 using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
                 using arithmetization_type = crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
-                using component_type = components::bitwise_or<arithmetization_type, BlueprintFieldType>;
+                using component_type = components::bitwise<arithmetization_type, BlueprintFieldType>;
 
                 auto x = frame.scalars[inst->getOperand(0)];
                 auto y = frame.scalars[inst->getOperand(1)];
+                const std::size_t bits = inst->getOperand(0)->getType()->getPrimitiveSizeInBits();
 
                 typename component_type::input_type instance_input = {x, y};
 
                 handle_component<BlueprintFieldType, component_type>
-                    (bp, assignment, internal_storage, statistics, param, instance_input, inst, frame);
+                    (bp, assignment, internal_storage, statistics, param, instance_input, inst, frame,
+                     bits, components::bitwise_operation::OR);
         }
 
     }    // namespace blueprint
@@ -0,0 +1,276 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_CIRCUIT_CACHE_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_CIRCUIT_CACHE_HPP_
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <llvm/IR/Module.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <nil/marshalling/endianness.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/status_type.hpp>
+#include <nil/crypto3/marshalling/zk/types/plonk/constraint_system.hpp>
+
+#include <nil/blueprint/blueprint/plonk/circuit.hpp>
+#include <nil/blueprint/blueprint/plonk/circuit_proxy.hpp>
+
+namespace nil {
+    namespace blueprint {
+
+        /**
+         * @brief On-disk cache of generated circuits.
+         *
+         * Circuit generation depends only on the IR module and its entry function, the field, the table description,
+         * the witness policy and limit, the amount of provers and the code of the assigner itself, so a circuit is
+         * stored under a hash of all of them and reused by later runs which fill the assignment table only.
+         *
+         * The file holds the marshalled constraint system followed by a text section with reserved lookup tables
+         * and gates, copy constraints and lookup tables used by each prover, which are not part of the
+         * constraint system.
+         */
+        namespace circuit_cache {
+            /// @brief Part of every key, must be changed with any change of components placement or of the file layout.
+            constexpr const std::uint32_t format_version = 2;
+
+            namespace detail {
+                inline void fnv1a(std::uint64_t &hash, const std::string &data) {
+                    for (unsigned char c : data) {
+                        hash ^= c;
+                        hash *= 0x100000001b3ULL;
+                    }
+                    // Separator, so that concatenations of different parts do not collide
+                    hash ^= 0xFF;
+                    hash *= 0x100000001b3ULL;
+                }
+
+                template<typename Range>
+                void write_range(std::ostream &out, const Range &range) {
+                    out << range.size();
+                    for (const auto &item : range) {
+                        out << " " << item;
+                    }
+                    out << "\n";
+                }
+
+                template<typename T>
+                bool read_range(std::istream &in, std::vector<T> &range) {
+                    std::size_t size;
+                    if (!(in >> size)) {
+                        return false;
+                    }
+                    range.resize(size);
+                    for (auto &item : range) {
+                        if (!(in >> item)) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+            }    // namespace detail
+
+            /// @brief Parts of the circuit used by one prover, as collected by its `circuit_proxy`.
+            struct usage {
+                std::vector<std::uint32_t> gates;
+                std::vector<std::uint32_t> copy_constraints;
+                std::vector<std::uint32_t> lookup_gates;
+                std::vector<std::string> lookup_tables;
+
+                template<typename ArithmetizationType>
+                static usage of(const circuit_proxy<ArithmetizationType> &proxy) {
+                    usage result;
+                    result.gates.assign(proxy.get_used_gates().begin(), proxy.get_used_gates().end());
+                    result.copy_constraints.assign(proxy.get_used_copy_constraints().begin(),
+                                                   proxy.get_used_copy_constraints().end());
+                    result.lookup_gates.assign(proxy.get_used_lookup_gates().begin(),
+                                               proxy.get_used_lookup_gates().end());
+                    result.lookup_tables.assign(proxy.get_used_lookup_tables().begin(),
+                                                proxy.get_used_lookup_tables().end());
+                    return result;
+                }
+
+                bool operator==(const usage &other) const {
+                    return gates == other.gates && copy_constraints == other.copy_constraints &&
+                           lookup_gates == other.lookup_gates && lookup_tables == other.lookup_tables;
+                }
+
+                bool operator!=(const usage &other) const {
+                    return !(*this == other);
+                }
+            };
+
+            template<typename BlueprintFieldType>
+            std::string key(const llvm::Module &module, const std::string &entry_function,
+                            const crypto3::zk::snark::plonk_table_description<BlueprintFieldType> &desc,
+                            const std::string &policy, std::uint32_t witness_limit, std::uint32_t max_num_provers) {
+                std::string module_text;
+                llvm::raw_string_ostream module_stream(module_text);
+                module_stream << module;
+                module_stream.flush();
+
+                std::ostringstream settings;
+                settings << format_version << " " << entry_function << " " << BlueprintFieldType::modulus << " "
+                         << desc.witness_columns << " " << desc.public_input_columns << " " << desc.constant_columns << " "
+                         << desc.selector_columns << " " << policy << " " << witness_limit << " " << max_num_provers;
+
+                std::uint64_t hash = 0xcbf29ce484222325ULL;
+                detail::fnv1a(hash, module_text);
+                detail::fnv1a(hash, settings.str());
+
+                std::ostringstream key_stream;
+                key_stream << std::hex << hash;
+                return key_stream.str();
+            }
+
+            inline std::string path(const std::string &cache_dir, const std::string &key) {
+                return cache_dir + "/" + key + ".crct";
+            }
+
+            template<typename BlueprintFieldType>
+            bool store(const circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                       const std::vector<usage> &provers_usage, const std::string &file_name) {
+                using ConstraintSystemType = crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+                using Endianness = nil::marshalling::option::big_endian;
+
+                auto filled_system =
+                    crypto3::marshalling::types::fill_plonk_constraint_system<Endianness, ConstraintSystemType>(bp);
+                std::vector<std::uint8_t> bytes(filled_system.length(), 0x00);
+                auto write_iter = bytes.begin();
+                if (filled_system.write(write_iter, bytes.size()) != nil::marshalling::status_type::success) {
+                    return false;
+                }
+
+                std::ostringstream extra;
+                // Tables are reserved again in the order of their indices, so that lookup gates keep referring to them
+                std::map<std::size_t, std::string> reserved_tables;
+                for (const auto &[name, index] : bp.get_reserved_indices()) {
+                    reserved_tables[index] = name;
+                }
+                extra << reserved_tables.size() << "\n";
+                for (const auto &[index, name] : reserved_tables) {
+                    extra << index << " " << name << "\n";
+                }
+                extra << provers_usage.size() << "\n";
+                for (const auto &prover_usage : provers_usage) {
+                    detail::write_range(extra, prover_usage.gates);
+                    detail::write_range(extra, prover_usage.copy_constraints);
+                    detail::write_range(extra, prover_usage.lookup_gates);
+                    detail::write_range(extra, prover_usage.lookup_tables);
+                }
+                const std::string extra_text = extra.str();
+
+                // Concurrent runs may store the same circuit, readers must never see a partially written file
+                const std::string tmp_name = file_name + ".tmp" + std::to_string(::getpid());
+                {
+                    std::ofstream out(tmp_name, std::ios::binary);
+                    out << bytes.size() << "\n";
+                    out.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+                    out.write(extra_text.data(), extra_text.size());
+                    if (!out) {
+                        std::remove(tmp_name.c_str());
+                        return false;
+                    }
+                }
+                return std::rename(tmp_name.c_str(), file_name.c_str()) == 0;
+            }
+
+            template<typename BlueprintFieldType>
+            bool load(circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                      std::vector<usage> &provers_usage, const std::string &file_name) {
+                using ConstraintSystemType = crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+                using Endianness = nil::marshalling::option::big_endian;
+                using TTypeBase = nil::marshalling::field_type<Endianness>;
+                using marshalled_type = crypto3::marshalling::types::plonk_constraint_system<TTypeBase, ConstraintSystemType>;
+
+                std::ifstream in(file_name, std::ios::binary);
+                if (!in) {
+                    return false;
+                }
+                std::size_t system_size;
+                if (!(in >> system_size) || in.get() != '\n') {
+                    return false;
+                }
+                std::vector<std::uint8_t> bytes(system_size);
+                if (!in.read(reinterpret_cast<char *>(bytes.data()), bytes.size())) {
+                    return false;
+                }
+                marshalled_type marshalled_system;
+                auto read_iter = bytes.cbegin();
+                if (marshalled_system.read(read_iter, bytes.size()) != nil::marshalling::status_type::success) {
+                    return false;
+                }
+                circuit<ConstraintSystemType> loaded(
+                    crypto3::marshalling::types::make_plonk_constraint_system<Endianness, ConstraintSystemType>(
+                        marshalled_system));
+
+                std::size_t tables_amount;
+                if (!(in >> tables_amount)) {
+                    return false;
+                }
+                for (std::size_t i = 0; i < tables_amount; i++) {
+                    std::size_t index;
+                    std::string name;
+                    if (!(in >> index >> name)) {
+                        return false;
+                    }
+                    loaded.reserve_table(name);
+                    if (loaded.get_reserved_indices().at(name) != index) {
+                        return false;
+                    }
+                }
+
+                std::size_t provers_amount;
+                if (!(in >> provers_amount)) {
+                    return false;
+                }
+                std::vector<usage> loaded_usage(provers_amount);
+                for (auto &prover_usage : loaded_usage) {
+                    if (!detail::read_range(in, prover_usage.gates) ||
+                        !detail::read_range(in, prover_usage.copy_constraints) ||
+                        !detail::read_range(in, prover_usage.lookup_gates) ||
+                        !detail::read_range(in, prover_usage.lookup_tables)) {
+                        return false;
+                    }
+                }
+                bp = std::move(loaded);
+                provers_usage = std::move(loaded_usage);
+                return true;
+            }
+        }    // namespace circuit_cache
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_CIRCUIT_CACHE_HPP_
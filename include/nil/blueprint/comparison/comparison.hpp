@@ -32,6 +32,8 @@
 #include <nil/blueprint/components/algebra/fields/plonk/non_native/comparison_mode.hpp>
 
 #include <nil/blueprint/handle_component.hpp>
+#include <nil/blueprint/fields/linear_combination.hpp>
+#include <nil/blueprint/range_facts.hpp>
 
 namespace nil {
     namespace blueprint {
@@ -115,10 +117,62 @@ namespace nil {
 
         }
 
+        namespace detail {
+            /// @brief Kinds of comparisons remembered in `range_facts`, `x < y` is kept as `y > x` and so on.
+            enum comparison_kind : int {
+                EQUAL = 0,
+                NOT_EQUAL,
+                GREATER_EQUAL,
+                GREATER_THAN
+            };
+
+            /**
+             * @brief Compare `x` and `y` which are both known to be less than 2^bitness.
+             *
+             * The range proofs are reused, so the flag is the most significant bit of
+             * x - y + 2^bitness (or x - y - 1 + 2^bitness for strict comparison) decomposed into bitness + 1 bits.
+             */
+            template<typename BlueprintFieldType>
+            crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>
+                handle_bounded_comparison(
+                    const crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type> &x,
+                    const crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type> &y,
+                    bool strict,
+                    std::size_t bitness,
+                    circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                    assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+                    &assignment,
+                    column_type<BlueprintFieldType> &internal_storage,
+                    component_calls &statistics,
+                    const common_component_parameters& param) {
+
+                using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
+                using value_type = typename BlueprintFieldType::value_type;
+                using integral_type = typename BlueprintFieldType::integral_type;
+                using component_type = components::bit_decomposition<
+                    crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>;
+
+                linear_expression<var> shifted_difference;
+                shifted_difference.terms = {{x, false}, {y, true}};
+                shifted_difference.constant = value_type(integral_type(1) << bitness);
+                if (strict) {
+                    shifted_difference.constant -= value_type::one();
+                }
+                var d = materialize_linear_expression<BlueprintFieldType>(
+                    shifted_difference, bp, assignment, internal_storage, statistics, param);
+
+                typename component_type::input_type instance_input({d});
+                return get_component_result<BlueprintFieldType, component_type>
+                    (bp, assignment, internal_storage, statistics, param, instance_input, bitness + 1,
+                     components::bit_composition_mode::MSB).output[0];
+            }
+        }    // namespace detail
+
         template<typename BlueprintFieldType>
             void handle_comparison_component(
                 const llvm::Instruction *inst,
                 stack_frame<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &frame,
+                range_facts<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &ranges,
                 llvm::CmpInst::Predicate p,
                 circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
                 assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
@@ -130,11 +184,12 @@ namespace nil {
 
                 using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
 
-                const var &x = frame.scalars[inst->getOperand(0)];
-                const var &y = frame.scalars[inst->getOperand(1)];
+                var x = frame.scalars[inst->getOperand(0)];
+                var y = frame.scalars[inst->getOperand(1)];
 
                 std::size_t bitness = inst->getOperand(0)->getType()->getPrimitiveSizeInBits();
 
+                // facts are taken in size estimation mode too, so that it places the same components as the real run
 
             switch (p) {
                 case llvm::CmpInst::ICMP_EQ:
@@ -142,10 +197,20 @@ namespace nil {
                     using eq_component_type = components::equality_flag<
                         crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>, BlueprintFieldType>;
 
+                    const int kind = p == llvm::CmpInst::ICMP_EQ ? detail::EQUAL : detail::NOT_EQUAL;
+                    const var *known_flag = ranges.find_comparison(x, y, kind);
+                    if (known_flag != nullptr) {
+                        handle_result<BlueprintFieldType>(assignment, inst, frame, {*known_flag}, param.gen_mode);
+                        break;
+                    }
+
                     auto component_result = handle_comparison_component_eq_neq<
                         BlueprintFieldType, eq_component_type>(
                             p, x, y, bitness, bp, assignment, internal_storage, statistics, param);
 
+                    const var flag = component_result.all_vars()[0].get();
+                    ranges.add_comparison(x, y, kind, flag);
+                    ranges.add_comparison(y, x, kind, flag);
                     handle_component_result<BlueprintFieldType, eq_component_type>
                         (assignment, inst, frame, component_result, param.gen_mode);
                     break;
@@ -177,10 +242,38 @@ namespace nil {
                         }
                     }
 
+                    // x <= y is y >= x and x < y is y > x
+                    const bool swapped = (p == llvm::CmpInst::ICMP_SLE || p == llvm::CmpInst::ICMP_ULE ||
+                                          p == llvm::CmpInst::ICMP_SLT || p == llvm::CmpInst::ICMP_ULT);
+                    const bool strict = (p == llvm::CmpInst::ICMP_SGT || p == llvm::CmpInst::ICMP_UGT ||
+                                         p == llvm::CmpInst::ICMP_SLT || p == llvm::CmpInst::ICMP_ULT);
+                    const var &lhs = swapped ? y : x;
+                    const var &rhs = swapped ? x : y;
+                    const int kind = strict ? detail::GREATER_THAN : detail::GREATER_EQUAL;
+                    const bool operands_bounded = ranges.is_bounded(lhs, bitness) && ranges.is_bounded(rhs, bitness);
+
+                    const var *known_flag = operands_bounded ? ranges.find_comparison(lhs, rhs, kind) : nullptr;
+                    if (known_flag != nullptr) {
+                        handle_result<BlueprintFieldType>(assignment, inst, frame, {*known_flag}, param.gen_mode);
+                        break;
+                    }
+
+                    if (operands_bounded && bitness + 1 < BlueprintFieldType::modulus_bits) {
+                        var flag = detail::handle_bounded_comparison<BlueprintFieldType>(
+                            lhs, rhs, strict, bitness, bp, assignment, internal_storage, statistics, param);
+                        ranges.add_comparison(lhs, rhs, kind, flag);
+                        handle_result<BlueprintFieldType>(assignment, inst, frame, {flag}, param.gen_mode);
+                        break;
+                    }
+
                     auto component_result = handle_comparison_component_others<
                         BlueprintFieldType, comp_component_type>(
                             p, x, y, bitness, bp, assignment, internal_storage, statistics, param);
 
+                    // comparison_flag range-checks both operands
+                    ranges.set_bound(x, bitness);
+                    ranges.set_bound(y, bitness);
+                    ranges.add_comparison(lhs, rhs, kind, component_result.all_vars()[0].get());
                     handle_component_result<BlueprintFieldType, comp_component_type>
                         (assignment, inst, frame, component_result, param.gen_mode);
                     break;
@@ -297,6 +297,11 @@ namespace nil {
                             assignment.witness(component.W(0), row) = gt.data[1].data[2].data[1];
                             res.output[11] = var(component.W(0), row++, false);
 
+                // rows of the loop and the exponentiation are allocated even though they are not filled yet
+                for (; row < start_row_index + component.rows_amount; row++) {
+                    assignment.witness(component.W(0), row) = BlueprintFieldType::value_type::zero();
+                }
+
                 return res;
 	    }
 
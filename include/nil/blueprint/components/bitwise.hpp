@@ -0,0 +1,407 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_BITWISE_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_BITWISE_HPP_
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_constraint.hpp>
+
+#include <nil/blueprint/blueprint/plonk/circuit.hpp>
+#include <nil/blueprint/blueprint/plonk/assignment.hpp>
+#include <nil/blueprint/component.hpp>
+#include <nil/blueprint/manifest.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace nil {
+    namespace blueprint {
+        namespace components {
+
+            enum class bitwise_operation {
+                AND,
+                OR,
+                XOR
+            };
+
+            /**
+             * @brief Bitwise AND, OR or XOR of integers using byte lookups.
+             *
+             * Operands are split into bytes. Every byte pair is looked up in "byte_and_xor_table/full"
+             * as (x_i, y_i, x_i & y_i, x_i ^ y_i), OR is taken as AND + XOR of bytes.
+             *
+             * Layout: each row keeps k = (witness_amount - 3) / 4 byte slots of 4 cells, slot i of the component
+             * is on row i / k. The first row additionally keeps x, y and the result in the last three
+             * columns used, where a single gate composes all bytes of the component through rotations.
+             * Unused slots are zero, which is a valid table entry.
+             *
+             * If the width is not a multiple of 8, the slot of the top byte is looked up once more scaled by
+             * 2^(8 - width % 8), which is a byte only if the top bytes of x and y fit into width % 8 bits.
+             */
+            template<typename ArithmetizationType, typename BlueprintFieldType>
+            class bitwise;
+
+            template<typename BlueprintFieldType>
+            class bitwise<
+                crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                    BlueprintFieldType>:
+                public plonk_component<BlueprintFieldType> {
+
+            public:
+                using component_type = plonk_component<BlueprintFieldType>;
+
+                using var = typename component_type::var;
+                using manifest_type = nil::blueprint::plonk_component_manifest;
+
+                constexpr static const std::size_t chunk_bits = 8;
+                constexpr static const std::size_t slot_width = 4;
+
+                static std::size_t chunks_amount(std::size_t bits) {
+                    return (bits + chunk_bits - 1) / chunk_bits;
+                }
+
+                static std::size_t slots_per_row(std::size_t witness_amount) {
+                    return (witness_amount - 3) / slot_width;
+                }
+
+                /// @brief Bits of the top byte, 0 if it is a full one.
+                static std::size_t top_chunk_bits(std::size_t bits) {
+                    return bits % chunk_bits;
+                }
+
+                /// @brief Composition and byte lookups, plus the bound of the top byte if it is not a full one.
+                static std::size_t get_gates_amount(std::size_t bits) {
+                    return top_chunk_bits(bits) == 0 ? 2 : 3;
+                }
+
+                class gate_manifest_type : public component_gate_manifest {
+                public:
+                    std::size_t bits;
+
+                    gate_manifest_type(std::size_t bits_) : bits(bits_) {}
+
+                    std::uint32_t gates_amount() const override {
+                        return bitwise::get_gates_amount(bits);
+                    }
+                };
+
+                static gate_manifest get_gate_manifest(std::size_t witness_amount, std::size_t bits,
+                                                       bitwise_operation operation) {
+                    gate_manifest manifest = gate_manifest(gate_manifest_type(bits));
+                    return manifest;
+                }
+
+                static manifest_type get_manifest(std::size_t bits, bitwise_operation operation) {
+                    // more columns than needed to keep all bytes in one row are useless
+                    return manifest_type(
+                        std::shared_ptr<manifest_param>(
+                            new manifest_range_param(slot_width + 3, slot_width * chunks_amount(bits) + 3 + 1)),
+                        false
+                    );
+                }
+
+                static std::size_t get_rows_amount(std::size_t witness_amount, std::size_t bits,
+                                                   bitwise_operation operation) {
+                    const std::size_t slots = slots_per_row(witness_amount);
+                    return (chunks_amount(bits) + slots - 1) / slots;
+                }
+
+                static std::string get_component_name(bitwise_operation operation) {
+                    switch (operation) {
+                        case bitwise_operation::AND:
+                            return "bitwise and";
+                        case bitwise_operation::OR:
+                            return "bitwise or";
+                        default:
+                            return "bitwise xor";
+                    }
+                }
+
+                const std::size_t bits;
+                const bitwise_operation operation;
+                const std::size_t gates_amount = get_gates_amount(bits);
+                const std::size_t rows_amount = get_rows_amount(this->witness_amount(), bits, operation);
+                const std::string component_name = get_component_name(operation);
+
+                std::map<std::string, std::size_t> component_lookup_tables() const {
+                    std::map<std::string, std::size_t> lookup_tables;
+                    lookup_tables["byte_and_xor_table/full"] = 0; // REQUIRED_TABLE
+                    return lookup_tables;
+                }
+
+                /// @brief Column of cell `cell` (0 - x, 1 - y, 2 - and, 3 - xor) of byte `chunk`.
+                std::size_t chunk_column(std::size_t chunk, std::size_t cell) const {
+                    return this->W(slot_width * (chunk % slots_per_row(this->witness_amount())) + cell);
+                }
+
+                std::int32_t chunk_row(std::size_t chunk) const {
+                    return chunk / slots_per_row(this->witness_amount());
+                }
+
+                /// @brief Column of x, y or result (0, 1, 2) on the first row.
+                std::size_t header_column(std::size_t cell) const {
+                    return this->W(slot_width * slots_per_row(this->witness_amount()) + cell);
+                }
+
+                struct input_type {
+                    var x, y;
+
+                    std::vector<std::reference_wrapper<var>> all_vars() {
+                        return {x, y};
+                    }
+                };
+
+                struct result_type {
+                    var output;
+
+                    result_type(const bitwise &component, std::uint32_t start_row_index) {
+                        output = var(component.header_column(2), start_row_index, false);
+                    }
+
+                    std::vector<std::reference_wrapper<var>> all_vars() {
+                        return {output};
+                    }
+                };
+
+                template<typename WitnessContainerType, typename ConstantContainerType,
+                         typename PublicInputContainerType>
+                bitwise(WitnessContainerType witness, ConstantContainerType constant,
+                        PublicInputContainerType public_input, std::size_t bits_, bitwise_operation operation_) :
+                    component_type(witness, constant, public_input, get_manifest(bits_, operation_)),
+                    bits(bits_), operation(operation_) {};
+
+                bitwise(
+                    std::initializer_list<typename component_type::witness_container_type::value_type> witnesses,
+                    std::initializer_list<typename component_type::constant_container_type::value_type> constants,
+                    std::initializer_list<typename component_type::public_input_container_type::value_type>
+                        public_inputs,
+                    std::size_t bits_, bitwise_operation operation_) :
+                    component_type(witnesses, constants, public_inputs, get_manifest(bits_, operation_)),
+                    bits(bits_), operation(operation_) {};
+            };
+
+            template<typename BlueprintFieldType>
+            using plonk_bitwise =
+                bitwise<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                    BlueprintFieldType>;
+
+            template<typename BlueprintFieldType>
+            std::size_t generate_composition_gate(
+                const plonk_bitwise<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_bitwise<BlueprintFieldType>::input_type &instance_input) {
+
+                using var = typename plonk_bitwise<BlueprintFieldType>::var;
+                using value_type = typename BlueprintFieldType::value_type;
+                using constraint_type = crypto3::zk::snark::plonk_constraint<BlueprintFieldType>;
+
+                const std::size_t chunks = plonk_bitwise<BlueprintFieldType>::chunks_amount(component.bits);
+                const value_type base = value_type(1u << plonk_bitwise<BlueprintFieldType>::chunk_bits);
+
+                constraint_type x_constraint = var(component.header_column(0), 0);
+                constraint_type y_constraint = var(component.header_column(1), 0);
+                constraint_type z_constraint = var(component.header_column(2), 0);
+                value_type power = value_type::one();
+                for (std::size_t i = 0; i < chunks; i++) {
+                    const auto row = component.chunk_row(i);
+                    x_constraint = x_constraint - power * var(component.chunk_column(i, 0), row);
+                    y_constraint = y_constraint - power * var(component.chunk_column(i, 1), row);
+                    switch (component.operation) {
+                        case bitwise_operation::AND:
+                            z_constraint = z_constraint - power * var(component.chunk_column(i, 2), row);
+                            break;
+                        case bitwise_operation::OR:
+                            z_constraint = z_constraint - power * var(component.chunk_column(i, 2), row) -
+                                           power * var(component.chunk_column(i, 3), row);
+                            break;
+                        case bitwise_operation::XOR:
+                            z_constraint = z_constraint - power * var(component.chunk_column(i, 3), row);
+                            break;
+                    }
+                    power *= base;
+                }
+                return bp.add_gate({x_constraint, y_constraint, z_constraint});
+            }
+
+            template<typename BlueprintFieldType>
+            std::size_t generate_lookup_gate(
+                const plonk_bitwise<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_bitwise<BlueprintFieldType>::input_type &instance_input) {
+
+                using var = typename plonk_bitwise<BlueprintFieldType>::var;
+                using lookup_constraint_type = crypto3::zk::snark::plonk_lookup_constraint<BlueprintFieldType>;
+
+                const auto &lookup_tables_indices = bp.get_reserved_indices();
+                const std::size_t table_id = lookup_tables_indices.at("byte_and_xor_table/full");
+
+                std::vector<lookup_constraint_type> constraints;
+                const std::size_t slots = plonk_bitwise<BlueprintFieldType>::slots_per_row(component.witness_amount());
+                for (std::size_t slot = 0; slot < slots; slot++) {
+                    constraints.push_back({table_id, {
+                        var(component.chunk_column(slot, 0), 0),
+                        var(component.chunk_column(slot, 1), 0),
+                        var(component.chunk_column(slot, 2), 0),
+                        var(component.chunk_column(slot, 3), 0)
+                    }});
+                }
+                return bp.add_lookup_gate(constraints);
+            }
+
+            /// @brief Lookup of the top byte slot scaled to the top of the byte, see `bitwise`.
+            template<typename BlueprintFieldType>
+            std::size_t generate_top_chunk_bound_gate(
+                const plonk_bitwise<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_bitwise<BlueprintFieldType>::input_type &instance_input) {
+
+                using component_type = plonk_bitwise<BlueprintFieldType>;
+                using var = typename component_type::var;
+                using value_type = typename BlueprintFieldType::value_type;
+                using lookup_constraint_type = crypto3::zk::snark::plonk_lookup_constraint<BlueprintFieldType>;
+
+                const auto &lookup_tables_indices = bp.get_reserved_indices();
+                const std::size_t table_id = lookup_tables_indices.at("byte_and_xor_table/full");
+
+                const std::size_t top_chunk = component_type::chunks_amount(component.bits) - 1;
+                const std::size_t shift = component_type::chunk_bits - component_type::top_chunk_bits(component.bits);
+                const value_type scale = value_type(1u << shift);
+                // x < 2^r and y < 2^r imply (x & y) < 2^r and (x ^ y) < 2^r, so all four cells scale alike
+                lookup_constraint_type constraint = {table_id, {
+                    scale * var(component.chunk_column(top_chunk, 0), 0),
+                    scale * var(component.chunk_column(top_chunk, 1), 0),
+                    scale * var(component.chunk_column(top_chunk, 2), 0),
+                    scale * var(component.chunk_column(top_chunk, 3), 0)
+                }};
+                return bp.add_lookup_gate({constraint});
+            }
+
+            template<typename BlueprintFieldType>
+            void generate_copy_constraints(
+                const plonk_bitwise<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_bitwise<BlueprintFieldType>::input_type &instance_input,
+                const std::size_t start_row_index) {
+
+                using var = typename plonk_bitwise<BlueprintFieldType>::var;
+
+                bp.add_copy_constraint({instance_input.x, var(component.header_column(0), start_row_index, false)});
+                bp.add_copy_constraint({instance_input.y, var(component.header_column(1), start_row_index, false)});
+            }
+
+            template<typename BlueprintFieldType>
+            typename plonk_bitwise<BlueprintFieldType>::result_type
+            generate_circuit(
+                const plonk_bitwise<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_bitwise<BlueprintFieldType>::input_type &instance_input,
+                const std::uint32_t start_row_index) {
+
+                std::size_t composition_selector = generate_composition_gate(component, bp, assignment, instance_input);
+                assignment.enable_selector(composition_selector, start_row_index);
+
+                std::size_t lookup_selector = generate_lookup_gate(component, bp, assignment, instance_input);
+                for (std::size_t row = 0; row < component.rows_amount; row++) {
+                    assignment.enable_selector(lookup_selector, start_row_index + row);
+                }
+
+                if (plonk_bitwise<BlueprintFieldType>::top_chunk_bits(component.bits) != 0) {
+                    const std::size_t top_chunk = plonk_bitwise<BlueprintFieldType>::chunks_amount(component.bits) - 1;
+                    std::size_t bound_selector = generate_top_chunk_bound_gate(component, bp, assignment, instance_input);
+                    assignment.enable_selector(bound_selector, start_row_index + component.chunk_row(top_chunk));
+                }
+
+                generate_copy_constraints(component, bp, assignment, instance_input, start_row_index);
+
+                return typename plonk_bitwise<BlueprintFieldType>::result_type(component, start_row_index);
+            }
+
+            template<typename BlueprintFieldType>
+            typename plonk_bitwise<BlueprintFieldType>::result_type
+            generate_assignments(
+                const plonk_bitwise<BlueprintFieldType> &component,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_bitwise<BlueprintFieldType>::input_type &instance_input,
+                const std::uint32_t start_row_index) {
+
+                using component_type = plonk_bitwise<BlueprintFieldType>;
+                using value_type = typename BlueprintFieldType::value_type;
+                using integral_type = typename BlueprintFieldType::integral_type;
+
+                const integral_type x = integral_type(var_value(assignment, instance_input.x).data);
+                const integral_type y = integral_type(var_value(assignment, instance_input.y).data);
+                const integral_type mask = (integral_type(1) << component_type::chunk_bits) - 1;
+
+                const std::size_t chunks = component_type::chunks_amount(component.bits);
+                const std::size_t slots = component_type::slots_per_row(component.witness_amount());
+                integral_type z = 0;
+                for (std::size_t i = 0; i < slots * component.rows_amount; i++) {
+                    const std::size_t row = start_row_index + component.chunk_row(i);
+                    integral_type x_chunk = 0;
+                    integral_type y_chunk = 0;
+                    if (i < chunks) {
+                        x_chunk = (x >> (i * component_type::chunk_bits)) & mask;
+                        y_chunk = (y >> (i * component_type::chunk_bits)) & mask;
+                    }
+                    const integral_type and_chunk = x_chunk & y_chunk;
+                    const integral_type xor_chunk = x_chunk ^ y_chunk;
+                    assignment.witness(component.chunk_column(i, 0), row) = value_type(x_chunk);
+                    assignment.witness(component.chunk_column(i, 1), row) = value_type(y_chunk);
+                    assignment.witness(component.chunk_column(i, 2), row) = value_type(and_chunk);
+                    assignment.witness(component.chunk_column(i, 3), row) = value_type(xor_chunk);
+
+                    integral_type z_chunk;
+                    switch (component.operation) {
+                        case bitwise_operation::AND:
+                            z_chunk = and_chunk;
+                            break;
+                        case bitwise_operation::OR:
+                            z_chunk = and_chunk + xor_chunk;
+                            break;
+                        default:
+                            z_chunk = xor_chunk;
+                            break;
+                    }
+                    z = z + (z_chunk << (i * component_type::chunk_bits));
+                }
+
+                assignment.witness(component.header_column(0), start_row_index) = value_type(x);
+                assignment.witness(component.header_column(1), start_row_index) = value_type(y);
+                assignment.witness(component.header_column(2), start_row_index) = value_type(z);
+
+                return typename component_type::result_type(component, start_row_index);
+            }
+        }    // namespace components
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_BITWISE_HPP_
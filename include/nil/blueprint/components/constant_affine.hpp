@@ -0,0 +1,228 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_CONSTANT_AFFINE_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_CONSTANT_AFFINE_HPP_
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+
+#include <nil/blueprint/blueprint/plonk/circuit.hpp>
+#include <nil/blueprint/blueprint/plonk/assignment.hpp>
+#include <nil/blueprint/component.hpp>
+#include <nil/blueprint/manifest.hpp>
+
+#include <string>
+
+namespace nil {
+    namespace blueprint {
+        namespace components {
+
+            /**
+             * @brief Native field affine map with compile-time coefficients: y = a * x + b.
+             *
+             * Layout: W0 = x, W1 = y on the first row. Coefficients are kept in C0, so they need neither
+             * witness cells nor copy constraints. Addition of a constant (a = 1) keeps b in C0 and
+             * multiplication by a constant (b = 0) keeps a in C0, both take 1 row. Any other map keeps
+             * a and b in C0 of two rows: the assigner gives every component a single constant column,
+             * and a second constant column would have to be reserved for every component to save this row.
+             */
+            template<typename ArithmetizationType, typename BlueprintFieldType>
+            class constant_affine;
+
+            template<typename BlueprintFieldType>
+            class constant_affine<
+                crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                    BlueprintFieldType>:
+                public plonk_component<BlueprintFieldType> {
+
+            public:
+                using component_type = plonk_component<BlueprintFieldType>;
+
+                using var = typename component_type::var;
+                using value_type = typename BlueprintFieldType::value_type;
+                using manifest_type = nil::blueprint::plonk_component_manifest;
+
+                class gate_manifest_type : public component_gate_manifest {
+                public:
+                    std::uint32_t gates_amount() const override {
+                        return constant_affine::gates_amount;
+                    }
+                };
+
+                static gate_manifest get_gate_manifest(std::size_t witness_amount, value_type a, value_type b) {
+                    static gate_manifest manifest = gate_manifest(gate_manifest_type());
+                    return manifest;
+                }
+
+                static manifest_type get_manifest(value_type a, value_type b) {
+                    static manifest_type manifest = manifest_type(
+                        std::shared_ptr<manifest_param>(new manifest_single_value_param(2)),
+                        true
+                    );
+                    return manifest;
+                }
+
+                static bool is_addition(value_type a, value_type b) {
+                    return a == value_type::one();
+                }
+
+                static bool is_multiplication(value_type a, value_type b) {
+                    return !is_addition(a, b) && b.is_zero();
+                }
+
+                static std::size_t get_rows_amount(std::size_t witness_amount, value_type a, value_type b) {
+                    return is_addition(a, b) || is_multiplication(a, b) ? 1 : 2;
+                }
+
+                constexpr static const std::size_t gates_amount = 1;
+                const std::size_t rows_amount;
+                const std::string component_name = "native field affine map with constant coefficients";
+
+                const value_type a;
+                const value_type b;
+
+                struct input_type {
+                    var x;
+
+                    std::vector<std::reference_wrapper<var>> all_vars() {
+                        return {x};
+                    }
+                };
+
+                struct result_type {
+                    var output;
+
+                    result_type(const constant_affine &component, std::uint32_t start_row_index) {
+                        output = var(component.W(1), start_row_index, false);
+                    }
+
+                    std::vector<std::reference_wrapper<var>> all_vars() {
+                        return {output};
+                    }
+                };
+
+                template<typename WitnessContainerType, typename ConstantContainerType,
+                         typename PublicInputContainerType>
+                constant_affine(WitnessContainerType witness, ConstantContainerType constant_columns,
+                                  PublicInputContainerType public_input, value_type a_, value_type b_) :
+                    component_type(witness, constant_columns, public_input, get_manifest(a_, b_)),
+                    rows_amount(get_rows_amount(this->witness_amount(), a_, b_)), a(a_), b(b_) {};
+
+                constant_affine(
+                    std::initializer_list<typename component_type::witness_container_type::value_type> witnesses,
+                    std::initializer_list<typename component_type::constant_container_type::value_type> constants,
+                    std::initializer_list<typename component_type::public_input_container_type::value_type>
+                        public_inputs,
+                    value_type a_, value_type b_) :
+                    component_type(witnesses, constants, public_inputs, get_manifest(a_, b_)),
+                    rows_amount(get_rows_amount(this->witness_amount(), a_, b_)), a(a_), b(b_) {};
+            };
+
+            template<typename BlueprintFieldType>
+            using plonk_constant_affine =
+                constant_affine<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                    BlueprintFieldType>;
+
+            template<typename BlueprintFieldType>
+            std::size_t generate_gates(
+                const plonk_constant_affine<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_constant_affine<BlueprintFieldType>::input_type &instance_input) {
+
+                using component_type = plonk_constant_affine<BlueprintFieldType>;
+                using var = typename component_type::var;
+
+                const var x = var(component.W(0), 0);
+                const var y = var(component.W(1), 0);
+                const var first_coefficient = var(component.C(0), 0, true, var::column_type::constant);
+                if (component_type::is_addition(component.a, component.b)) {
+                    return bp.add_gate(x + first_coefficient - y);
+                }
+                if (component_type::is_multiplication(component.a, component.b)) {
+                    return bp.add_gate(first_coefficient * x - y);
+                }
+                const var second_coefficient = var(component.C(0), 1, true, var::column_type::constant);
+                return bp.add_gate(first_coefficient * x + second_coefficient - y);
+            }
+
+            template<typename BlueprintFieldType>
+            void generate_copy_constraints(
+                const plonk_constant_affine<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_constant_affine<BlueprintFieldType>::input_type &instance_input,
+                const std::size_t start_row_index) {
+
+                using var = typename plonk_constant_affine<BlueprintFieldType>::var;
+
+                bp.add_copy_constraint({instance_input.x, var(component.W(0), start_row_index, false)});
+            }
+
+            template<typename BlueprintFieldType>
+            typename plonk_constant_affine<BlueprintFieldType>::result_type
+            generate_circuit(
+                const plonk_constant_affine<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_constant_affine<BlueprintFieldType>::input_type &instance_input,
+                const std::uint32_t start_row_index) {
+
+                using component_type = plonk_constant_affine<BlueprintFieldType>;
+
+                std::size_t selector_index = generate_gates(component, bp, assignment, instance_input);
+                assignment.enable_selector(selector_index, start_row_index);
+                generate_copy_constraints(component, bp, assignment, instance_input, start_row_index);
+                if (component_type::is_addition(component.a, component.b)) {
+                    assignment.constant(component.C(0), start_row_index) = component.b;
+                } else if (component_type::is_multiplication(component.a, component.b)) {
+                    assignment.constant(component.C(0), start_row_index) = component.a;
+                } else {
+                    assignment.constant(component.C(0), start_row_index) = component.a;
+                    assignment.constant(component.C(0), start_row_index + 1) = component.b;
+                }
+
+                return typename plonk_constant_affine<BlueprintFieldType>::result_type(component, start_row_index);
+            }
+
+            template<typename BlueprintFieldType>
+            typename plonk_constant_affine<BlueprintFieldType>::result_type
+            generate_assignments(
+                const plonk_constant_affine<BlueprintFieldType> &component,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_constant_affine<BlueprintFieldType>::input_type &instance_input,
+                const std::uint32_t start_row_index) {
+
+                const auto x = var_value(assignment, instance_input.x);
+                assignment.witness(component.W(0), start_row_index) = x;
+                assignment.witness(component.W(1), start_row_index) = component.a * x + component.b;
+
+                return typename plonk_constant_affine<BlueprintFieldType>::result_type(component, start_row_index);
+            }
+        }    // namespace components
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_CONSTANT_AFFINE_HPP_
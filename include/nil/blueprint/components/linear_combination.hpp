@@ -0,0 +1,236 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_LINEAR_COMBINATION_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_LINEAR_COMBINATION_HPP_
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+
+#include <nil/blueprint/blueprint/plonk/circuit.hpp>
+#include <nil/blueprint/blueprint/plonk/assignment.hpp>
+#include <nil/blueprint/component.hpp>
+#include <nil/blueprint/manifest.hpp>
+
+#include <string>
+#include <vector>
+
+namespace nil {
+    namespace blueprint {
+        namespace components {
+
+            /**
+             * @brief Native field sum y = x_0 + ... + x_{p-1} - x_p - ... - x_{p+n-1} + c in one row.
+             *
+             * Layout (1 row): W0..W(p+n-1) = terms, positive ones first, W(p+n) = y, c is kept in C0.
+             * C0 is neither constrained nor assigned if c is zero. The gate depends on p, n and whether c is zero,
+             * so it is shared between all sums of the same shape.
+             */
+            template<typename ArithmetizationType, typename BlueprintFieldType>
+            class linear_combination;
+
+            template<typename BlueprintFieldType>
+            class linear_combination<
+                crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                    BlueprintFieldType>:
+                public plonk_component<BlueprintFieldType> {
+
+            public:
+                using component_type = plonk_component<BlueprintFieldType>;
+
+                using var = typename component_type::var;
+                using value_type = typename BlueprintFieldType::value_type;
+                using manifest_type = nil::blueprint::plonk_component_manifest;
+
+                class gate_manifest_type : public component_gate_manifest {
+                public:
+                    std::uint32_t gates_amount() const override {
+                        return linear_combination::gates_amount;
+                    }
+                };
+
+                static gate_manifest get_gate_manifest(std::size_t witness_amount, std::size_t positive_amount,
+                                                       std::size_t negative_amount, value_type constant) {
+                    static gate_manifest manifest = gate_manifest(gate_manifest_type());
+                    return manifest;
+                }
+
+                static manifest_type get_manifest(std::size_t positive_amount, std::size_t negative_amount,
+                                                  value_type constant) {
+                    return manifest_type(
+                        std::shared_ptr<manifest_param>(
+                            new manifest_single_value_param(positive_amount + negative_amount + 1)),
+                        true
+                    );
+                }
+
+                constexpr static std::size_t get_rows_amount(std::size_t witness_amount, std::size_t positive_amount,
+                                                             std::size_t negative_amount, value_type constant) {
+                    return 1;
+                }
+
+                constexpr static const std::size_t gates_amount = 1;
+                const std::size_t rows_amount = 1;
+                const std::string component_name = "native field linear combination";
+
+                const std::size_t positive_amount;
+                const std::size_t negative_amount;
+                const value_type constant;
+
+                struct input_type {
+                    std::vector<var> terms;
+
+                    std::vector<std::reference_wrapper<var>> all_vars() {
+                        std::vector<std::reference_wrapper<var>> result;
+                        for (auto &term : terms) {
+                            result.push_back(term);
+                        }
+                        return result;
+                    }
+                };
+
+                struct result_type {
+                    var output;
+
+                    result_type(const linear_combination &component, std::uint32_t start_row_index) {
+                        output = var(component.W(component.positive_amount + component.negative_amount),
+                                     start_row_index, false);
+                    }
+
+                    std::vector<std::reference_wrapper<var>> all_vars() {
+                        return {output};
+                    }
+                };
+
+                template<typename WitnessContainerType, typename ConstantContainerType,
+                         typename PublicInputContainerType>
+                linear_combination(WitnessContainerType witness, ConstantContainerType constant_columns,
+                                   PublicInputContainerType public_input, std::size_t positive_amount_,
+                                   std::size_t negative_amount_, value_type constant_) :
+                    component_type(witness, constant_columns, public_input,
+                                   get_manifest(positive_amount_, negative_amount_, constant_)),
+                    positive_amount(positive_amount_), negative_amount(negative_amount_), constant(constant_) {};
+
+                linear_combination(
+                    std::initializer_list<typename component_type::witness_container_type::value_type> witnesses,
+                    std::initializer_list<typename component_type::constant_container_type::value_type> constants,
+                    std::initializer_list<typename component_type::public_input_container_type::value_type>
+                        public_inputs,
+                    std::size_t positive_amount_, std::size_t negative_amount_, value_type constant_) :
+                    component_type(witnesses, constants, public_inputs,
+                                   get_manifest(positive_amount_, negative_amount_, constant_)),
+                    positive_amount(positive_amount_), negative_amount(negative_amount_), constant(constant_) {};
+            };
+
+            template<typename BlueprintFieldType>
+            using plonk_linear_combination =
+                linear_combination<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                    BlueprintFieldType>;
+
+            template<typename BlueprintFieldType>
+            std::size_t generate_gates(
+                const plonk_linear_combination<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_linear_combination<BlueprintFieldType>::input_type &instance_input) {
+
+                using var = typename plonk_linear_combination<BlueprintFieldType>::var;
+                using constraint_type = crypto3::zk::snark::plonk_constraint<BlueprintFieldType>;
+
+                const std::size_t terms_amount = component.positive_amount + component.negative_amount;
+                constraint_type constraint = var(component.W(terms_amount), 0);
+                if (!component.constant.is_zero()) {
+                    constraint = constraint - var(component.C(0), 0, true, var::column_type::constant);
+                }
+                for (std::size_t i = 0; i < terms_amount; i++) {
+                    if (i < component.positive_amount) {
+                        constraint = constraint - var(component.W(i), 0);
+                    } else {
+                        constraint = constraint + var(component.W(i), 0);
+                    }
+                }
+                return bp.add_gate(constraint);
+            }
+
+            template<typename BlueprintFieldType>
+            void generate_copy_constraints(
+                const plonk_linear_combination<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_linear_combination<BlueprintFieldType>::input_type &instance_input,
+                const std::size_t start_row_index) {
+
+                using var = typename plonk_linear_combination<BlueprintFieldType>::var;
+
+                for (std::size_t i = 0; i < instance_input.terms.size(); i++) {
+                    bp.add_copy_constraint({instance_input.terms[i], var(component.W(i), start_row_index, false)});
+                }
+            }
+
+            template<typename BlueprintFieldType>
+            typename plonk_linear_combination<BlueprintFieldType>::result_type
+            generate_circuit(
+                const plonk_linear_combination<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_linear_combination<BlueprintFieldType>::input_type &instance_input,
+                const std::uint32_t start_row_index) {
+
+                std::size_t selector_index = generate_gates(component, bp, assignment, instance_input);
+                assignment.enable_selector(selector_index, start_row_index);
+                generate_copy_constraints(component, bp, assignment, instance_input, start_row_index);
+                if (!component.constant.is_zero()) {
+                    assignment.constant(component.C(0), start_row_index) = component.constant;
+                }
+
+                return typename plonk_linear_combination<BlueprintFieldType>::result_type(component, start_row_index);
+            }
+
+            template<typename BlueprintFieldType>
+            typename plonk_linear_combination<BlueprintFieldType>::result_type
+            generate_assignments(
+                const plonk_linear_combination<BlueprintFieldType> &component,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_linear_combination<BlueprintFieldType>::input_type &instance_input,
+                const std::uint32_t start_row_index) {
+
+                typename BlueprintFieldType::value_type sum = component.constant;
+                for (std::size_t i = 0; i < instance_input.terms.size(); i++) {
+                    const auto x = var_value(assignment, instance_input.terms[i]);
+                    assignment.witness(component.W(i), start_row_index) = x;
+                    if (i < component.positive_amount) {
+                        sum += x;
+                    } else {
+                        sum -= x;
+                    }
+                }
+                assignment.witness(component.W(instance_input.terms.size()), start_row_index) = sum;
+
+                return typename plonk_linear_combination<BlueprintFieldType>::result_type(component, start_row_index);
+            }
+        }    // namespace components
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_LINEAR_COMBINATION_HPP_
@@ -0,0 +1,238 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_POWER_OF_TWO_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_POWER_OF_TWO_HPP_
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+
+#include <nil/blueprint/blueprint/plonk/circuit.hpp>
+#include <nil/blueprint/blueprint/plonk/assignment.hpp>
+#include <nil/blueprint/component.hpp>
+#include <nil/blueprint/manifest.hpp>
+
+#include <string>
+#include <vector>
+
+namespace nil {
+    namespace blueprint {
+        namespace components {
+
+            /**
+             * @brief p = 2^s for a shift amount s of an integer of the given bitness.
+             *
+             * s is decomposed into k = ceil(log2(bitness)) bits b_j, which also proves s < 2^k,
+             * and p is the product of (1 + b_j * (2^(2^j) - 1)).
+             *
+             * Layout (2 rows, k + 1 columns): W0 = s and W(1 + j) = b_j on the first row,
+             * W(j) = partial product up to b_j on the second row, the last one is p.
+             */
+            template<typename ArithmetizationType, typename BlueprintFieldType>
+            class power_of_two;
+
+            template<typename BlueprintFieldType>
+            class power_of_two<
+                crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                    BlueprintFieldType>:
+                public plonk_component<BlueprintFieldType> {
+
+            public:
+                using component_type = plonk_component<BlueprintFieldType>;
+
+                using var = typename component_type::var;
+                using manifest_type = nil::blueprint::plonk_component_manifest;
+
+                static std::size_t shift_bits_amount(std::size_t bitness) {
+                    std::size_t k = 1;
+                    while ((std::size_t(1) << k) < bitness) {
+                        k++;
+                    }
+                    return k;
+                }
+
+                class gate_manifest_type : public component_gate_manifest {
+                public:
+                    std::uint32_t gates_amount() const override {
+                        return power_of_two::gates_amount;
+                    }
+                };
+
+                static gate_manifest get_gate_manifest(std::size_t witness_amount, std::size_t bitness) {
+                    static gate_manifest manifest = gate_manifest(gate_manifest_type());
+                    return manifest;
+                }
+
+                static manifest_type get_manifest(std::size_t bitness) {
+                    return manifest_type(
+                        std::shared_ptr<manifest_param>(new manifest_single_value_param(shift_bits_amount(bitness) + 1)),
+                        false
+                    );
+                }
+
+                constexpr static std::size_t get_rows_amount(std::size_t witness_amount, std::size_t bitness) {
+                    return 2;
+                }
+
+                constexpr static const std::size_t gates_amount = 1;
+                const std::size_t rows_amount = 2;
+                const std::string component_name = "power of two";
+
+                const std::size_t bitness;
+                const std::size_t shift_bits = shift_bits_amount(bitness);
+
+                struct input_type {
+                    var shift;
+
+                    std::vector<std::reference_wrapper<var>> all_vars() {
+                        return {shift};
+                    }
+                };
+
+                struct result_type {
+                    var output;
+
+                    result_type(const power_of_two &component, std::uint32_t start_row_index) {
+                        output = var(component.W(component.shift_bits - 1), start_row_index + 1, false);
+                    }
+
+                    std::vector<std::reference_wrapper<var>> all_vars() {
+                        return {output};
+                    }
+                };
+
+                template<typename WitnessContainerType, typename ConstantContainerType,
+                         typename PublicInputContainerType>
+                power_of_two(WitnessContainerType witness, ConstantContainerType constant,
+                             PublicInputContainerType public_input, std::size_t bitness_) :
+                    component_type(witness, constant, public_input, get_manifest(bitness_)),
+                    bitness(bitness_) {};
+
+                power_of_two(
+                    std::initializer_list<typename component_type::witness_container_type::value_type> witnesses,
+                    std::initializer_list<typename component_type::constant_container_type::value_type> constants,
+                    std::initializer_list<typename component_type::public_input_container_type::value_type>
+                        public_inputs,
+                    std::size_t bitness_) :
+                    component_type(witnesses, constants, public_inputs, get_manifest(bitness_)),
+                    bitness(bitness_) {};
+            };
+
+            template<typename BlueprintFieldType>
+            using plonk_power_of_two =
+                power_of_two<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                    BlueprintFieldType>;
+
+            template<typename BlueprintFieldType>
+            std::size_t generate_gates(
+                const plonk_power_of_two<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_power_of_two<BlueprintFieldType>::input_type &instance_input) {
+
+                using var = typename plonk_power_of_two<BlueprintFieldType>::var;
+                using value_type = typename BlueprintFieldType::value_type;
+                using integral_type = typename BlueprintFieldType::integral_type;
+                using constraint_type = crypto3::zk::snark::plonk_constraint<BlueprintFieldType>;
+
+                std::vector<constraint_type> constraints;
+                constraint_type composition = var(component.W(0), 0);
+                for (std::size_t j = 0; j < component.shift_bits; j++) {
+                    var b = var(component.W(1 + j), 0);
+                    constraints.push_back(b * (b - value_type::one()));
+                    composition = composition - value_type(integral_type(1) << j) * b;
+
+                    // multiplier is 2^(2^j) if the bit is set and 1 otherwise
+                    const value_type factor = value_type(integral_type(1) << (std::size_t(1) << j)) - value_type::one();
+                    if (j == 0) {
+                        constraints.push_back(var(component.W(0), 1) - (value_type::one() + factor * b));
+                    } else {
+                        constraints.push_back(var(component.W(j), 1) - var(component.W(j - 1), 1) * (value_type::one() + factor * b));
+                    }
+                }
+                constraints.push_back(composition);
+                return bp.add_gate(constraints);
+            }
+
+            template<typename BlueprintFieldType>
+            void generate_copy_constraints(
+                const plonk_power_of_two<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_power_of_two<BlueprintFieldType>::input_type &instance_input,
+                const std::size_t start_row_index) {
+
+                using var = typename plonk_power_of_two<BlueprintFieldType>::var;
+
+                bp.add_copy_constraint({instance_input.shift, var(component.W(0), start_row_index, false)});
+            }
+
+            template<typename BlueprintFieldType>
+            typename plonk_power_of_two<BlueprintFieldType>::result_type
+            generate_circuit(
+                const plonk_power_of_two<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_power_of_two<BlueprintFieldType>::input_type &instance_input,
+                const std::uint32_t start_row_index) {
+
+                std::size_t selector_index = generate_gates(component, bp, assignment, instance_input);
+                assignment.enable_selector(selector_index, start_row_index);
+                generate_copy_constraints(component, bp, assignment, instance_input, start_row_index);
+
+                return typename plonk_power_of_two<BlueprintFieldType>::result_type(component, start_row_index);
+            }
+
+            template<typename BlueprintFieldType>
+            typename plonk_power_of_two<BlueprintFieldType>::result_type
+            generate_assignments(
+                const plonk_power_of_two<BlueprintFieldType> &component,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_power_of_two<BlueprintFieldType>::input_type &instance_input,
+                const std::uint32_t start_row_index) {
+
+                using value_type = typename BlueprintFieldType::value_type;
+                using integral_type = typename BlueprintFieldType::integral_type;
+
+                const value_type s = var_value(assignment, instance_input.shift);
+                const integral_type s_integral = integral_type(s.data);
+                assignment.witness(component.W(0), start_row_index) = s;
+
+                value_type product = value_type::one();
+                for (std::size_t j = 0; j < component.shift_bits; j++) {
+                    const bool bit = ((s_integral >> j) & 1) != 0;
+                    assignment.witness(component.W(1 + j), start_row_index) = bit ? value_type::one() : value_type::zero();
+                    if (bit) {
+                        product *= value_type(integral_type(1) << (std::size_t(1) << j));
+                    }
+                    assignment.witness(component.W(j), start_row_index + 1) = product;
+                }
+
+                return typename plonk_power_of_two<BlueprintFieldType>::result_type(component, start_row_index);
+            }
+        }    // namespace components
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_POWER_OF_TWO_HPP_
@@ -0,0 +1,275 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_RADIX_COMPOSITION_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_RADIX_COMPOSITION_HPP_
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_constraint.hpp>
+
+#include <nil/blueprint/blueprint/plonk/circuit.hpp>
+#include <nil/blueprint/blueprint/plonk/assignment.hpp>
+#include <nil/blueprint/component.hpp>
+#include <nil/blueprint/manifest.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace nil {
+    namespace blueprint {
+        namespace components {
+
+            /**
+             * @brief y = sum x_i * 2^(digit_bits * (n - 1 - i)), digits are in big-endian order.
+             *
+             * Used to pack bytes into words and words into wider values. Byte digits are looked up in
+             * "byte_and_xor_table/full" as (x, x, x & x, x ^ x), so they are range-checked here. Wider digits
+             * are not range-checked, they must be bounded by the components which produce them.
+             *
+             * Layout (1 row): W0..W(n-1) = digits, W(n) = y.
+             */
+            template<typename ArithmetizationType, typename BlueprintFieldType>
+            class radix_composition;
+
+            template<typename BlueprintFieldType>
+            class radix_composition<
+                crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                    BlueprintFieldType>:
+                public plonk_component<BlueprintFieldType> {
+
+            public:
+                using component_type = plonk_component<BlueprintFieldType>;
+
+                using var = typename component_type::var;
+                using manifest_type = nil::blueprint::plonk_component_manifest;
+
+                constexpr static const std::size_t byte_bits = 8;
+
+                static bool has_digit_lookup(std::size_t digit_bits) {
+                    return digit_bits == byte_bits;
+                }
+
+                /// @brief Composition, plus the byte lookups if digits are bytes.
+                static std::size_t get_gates_amount(std::size_t digit_bits) {
+                    return has_digit_lookup(digit_bits) ? 2 : 1;
+                }
+
+                class gate_manifest_type : public component_gate_manifest {
+                public:
+                    std::size_t digit_bits;
+
+                    gate_manifest_type(std::size_t digit_bits_) : digit_bits(digit_bits_) {}
+
+                    std::uint32_t gates_amount() const override {
+                        return radix_composition::get_gates_amount(digit_bits);
+                    }
+                };
+
+                static gate_manifest get_gate_manifest(std::size_t witness_amount, std::size_t digits_amount,
+                                                       std::size_t digit_bits) {
+                    gate_manifest manifest = gate_manifest(gate_manifest_type(digit_bits));
+                    return manifest;
+                }
+
+                static manifest_type get_manifest(std::size_t digits_amount, std::size_t digit_bits) {
+                    return manifest_type(
+                        std::shared_ptr<manifest_param>(new manifest_single_value_param(digits_amount + 1)),
+                        false
+                    );
+                }
+
+                constexpr static std::size_t get_rows_amount(std::size_t witness_amount, std::size_t digits_amount,
+                                                             std::size_t digit_bits) {
+                    return 1;
+                }
+
+                const std::size_t digits_amount;
+                const std::size_t digit_bits;
+
+                const std::size_t gates_amount = get_gates_amount(digit_bits);
+                const std::size_t rows_amount = 1;
+                const std::string component_name = "radix composition";
+
+                std::map<std::string, std::size_t> component_lookup_tables() const {
+                    std::map<std::string, std::size_t> lookup_tables;
+                    if (has_digit_lookup(digit_bits)) {
+                        lookup_tables["byte_and_xor_table/full"] = 0; // REQUIRED_TABLE
+                    }
+                    return lookup_tables;
+                }
+
+                struct input_type {
+                    std::vector<var> digits;
+
+                    std::vector<std::reference_wrapper<var>> all_vars() {
+                        std::vector<std::reference_wrapper<var>> result;
+                        for (auto &digit : digits) {
+                            result.push_back(digit);
+                        }
+                        return result;
+                    }
+                };
+
+                struct result_type {
+                    var output;
+
+                    result_type(const radix_composition &component, std::uint32_t start_row_index) {
+                        output = var(component.W(component.digits_amount), start_row_index, false);
+                    }
+
+                    std::vector<std::reference_wrapper<var>> all_vars() {
+                        return {output};
+                    }
+                };
+
+                template<typename WitnessContainerType, typename ConstantContainerType,
+                         typename PublicInputContainerType>
+                radix_composition(WitnessContainerType witness, ConstantContainerType constant,
+                                  PublicInputContainerType public_input, std::size_t digits_amount_,
+                                  std::size_t digit_bits_) :
+                    component_type(witness, constant, public_input, get_manifest(digits_amount_, digit_bits_)),
+                    digits_amount(digits_amount_), digit_bits(digit_bits_) {};
+
+                radix_composition(
+                    std::initializer_list<typename component_type::witness_container_type::value_type> witnesses,
+                    std::initializer_list<typename component_type::constant_container_type::value_type> constants,
+                    std::initializer_list<typename component_type::public_input_container_type::value_type>
+                        public_inputs,
+                    std::size_t digits_amount_, std::size_t digit_bits_) :
+                    component_type(witnesses, constants, public_inputs, get_manifest(digits_amount_, digit_bits_)),
+                    digits_amount(digits_amount_), digit_bits(digit_bits_) {};
+            };
+
+            template<typename BlueprintFieldType>
+            using plonk_radix_composition =
+                radix_composition<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                    BlueprintFieldType>;
+
+            template<typename BlueprintFieldType>
+            std::size_t generate_gates(
+                const plonk_radix_composition<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_radix_composition<BlueprintFieldType>::input_type &instance_input) {
+
+                using var = typename plonk_radix_composition<BlueprintFieldType>::var;
+                using value_type = typename BlueprintFieldType::value_type;
+                using integral_type = typename BlueprintFieldType::integral_type;
+                using constraint_type = crypto3::zk::snark::plonk_constraint<BlueprintFieldType>;
+
+                constraint_type constraint = var(component.W(component.digits_amount), 0);
+                for (std::size_t i = 0; i < component.digits_amount; i++) {
+                    const std::size_t shift = component.digit_bits * (component.digits_amount - 1 - i);
+                    constraint = constraint - value_type(integral_type(1) << shift) * var(component.W(i), 0);
+                }
+                return bp.add_gate(constraint);
+            }
+
+            template<typename BlueprintFieldType>
+            std::size_t generate_lookup_gate(
+                const plonk_radix_composition<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_radix_composition<BlueprintFieldType>::input_type &instance_input) {
+
+                using var = typename plonk_radix_composition<BlueprintFieldType>::var;
+                using value_type = typename BlueprintFieldType::value_type;
+                using lookup_constraint_type = crypto3::zk::snark::plonk_lookup_constraint<BlueprintFieldType>;
+
+                const auto &lookup_tables_indices = bp.get_reserved_indices();
+                const std::size_t table_id = lookup_tables_indices.at("byte_and_xor_table/full");
+
+                // (x, x, x, 0) is a table entry only if x is a byte
+                std::vector<lookup_constraint_type> constraints;
+                for (std::size_t i = 0; i < component.digits_amount; i++) {
+                    const var digit = var(component.W(i), 0);
+                    constraints.push_back({table_id, {digit, digit, digit, value_type::zero() * digit}});
+                }
+                return bp.add_lookup_gate(constraints);
+            }
+
+            template<typename BlueprintFieldType>
+            void generate_copy_constraints(
+                const plonk_radix_composition<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_radix_composition<BlueprintFieldType>::input_type &instance_input,
+                const std::size_t start_row_index) {
+
+                using var = typename plonk_radix_composition<BlueprintFieldType>::var;
+
+                for (std::size_t i = 0; i < instance_input.digits.size(); i++) {
+                    bp.add_copy_constraint({instance_input.digits[i], var(component.W(i), start_row_index, false)});
+                }
+            }
+
+            template<typename BlueprintFieldType>
+            typename plonk_radix_composition<BlueprintFieldType>::result_type
+            generate_circuit(
+                const plonk_radix_composition<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_radix_composition<BlueprintFieldType>::input_type &instance_input,
+                const std::uint32_t start_row_index) {
+
+                std::size_t selector_index = generate_gates(component, bp, assignment, instance_input);
+                assignment.enable_selector(selector_index, start_row_index);
+                if (plonk_radix_composition<BlueprintFieldType>::has_digit_lookup(component.digit_bits)) {
+                    std::size_t lookup_selector = generate_lookup_gate(component, bp, assignment, instance_input);
+                    assignment.enable_selector(lookup_selector, start_row_index);
+                }
+                generate_copy_constraints(component, bp, assignment, instance_input, start_row_index);
+
+                return typename plonk_radix_composition<BlueprintFieldType>::result_type(component, start_row_index);
+            }
+
+            template<typename BlueprintFieldType>
+            typename plonk_radix_composition<BlueprintFieldType>::result_type
+            generate_assignments(
+                const plonk_radix_composition<BlueprintFieldType> &component,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_radix_composition<BlueprintFieldType>::input_type &instance_input,
+                const std::uint32_t start_row_index) {
+
+                using value_type = typename BlueprintFieldType::value_type;
+                using integral_type = typename BlueprintFieldType::integral_type;
+
+                value_type result = value_type::zero();
+                const value_type base = value_type(integral_type(1) << component.digit_bits);
+                for (std::size_t i = 0; i < instance_input.digits.size(); i++) {
+                    const auto digit = var_value(assignment, instance_input.digits[i]);
+                    assignment.witness(component.W(i), start_row_index) = digit;
+                    result = result * base + digit;
+                }
+                assignment.witness(component.W(component.digits_amount), start_row_index) = result;
+
+                return typename plonk_radix_composition<BlueprintFieldType>::result_type(component, start_row_index);
+            }
+        }    // namespace components
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_RADIX_COMPOSITION_HPP_
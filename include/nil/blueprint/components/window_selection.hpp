@@ -0,0 +1,257 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_WINDOW_SELECTION_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_WINDOW_SELECTION_HPP_
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+
+#include <nil/blueprint/blueprint/plonk/circuit.hpp>
+#include <nil/blueprint/blueprint/plonk/assignment.hpp>
+#include <nil/blueprint/component.hpp>
+#include <nil/blueprint/manifest.hpp>
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace nil {
+    namespace blueprint {
+        namespace components {
+
+            /**
+             * @brief Selects table[b0 + 2 * b1] for several tables of four entries at once.
+             *
+             * Bits must be boolean, table entries are expected to be copied from constants, so the output is
+             * one of the entries. Layout: every row repeats b0, b1 in W0, W1 and holds slots_per_row slots of
+             * (t0, t1, t2, t3, out) starting at W2. Unused slots of the last row are zero.
+             */
+            template<typename ArithmetizationType, typename BlueprintFieldType>
+            class window_selection;
+
+            template<typename BlueprintFieldType>
+            class window_selection<
+                crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                    BlueprintFieldType>:
+                public plonk_component<BlueprintFieldType> {
+
+            public:
+                using component_type = plonk_component<BlueprintFieldType>;
+
+                using var = typename component_type::var;
+                using manifest_type = nil::blueprint::plonk_component_manifest;
+
+                constexpr static const std::size_t table_size = 4;
+                constexpr static const std::size_t slot_size = table_size + 1;
+                constexpr static const std::size_t slots_per_row = 2;
+
+                class gate_manifest_type : public component_gate_manifest {
+                public:
+                    std::uint32_t gates_amount() const override {
+                        return window_selection::gates_amount;
+                    }
+                };
+
+                static gate_manifest get_gate_manifest(std::size_t witness_amount, std::size_t selections_amount) {
+                    static gate_manifest manifest = gate_manifest(gate_manifest_type());
+                    return manifest;
+                }
+
+                static manifest_type get_manifest(std::size_t selections_amount) {
+                    static manifest_type manifest = manifest_type(
+                        std::shared_ptr<manifest_param>(new manifest_single_value_param(2 + slots_per_row * slot_size)),
+                        false
+                    );
+                    return manifest;
+                }
+
+                constexpr static std::size_t get_rows_amount(std::size_t witness_amount, std::size_t selections_amount) {
+                    return (selections_amount + slots_per_row - 1) / slots_per_row;
+                }
+
+                constexpr static const std::size_t gates_amount = 1;
+                const std::size_t selections_amount;
+                const std::size_t rows_amount = get_rows_amount(this->witness_amount(), selections_amount);
+                const std::string component_name = "window selection";
+
+                struct input_type {
+                    var b0;
+                    var b1;
+                    std::vector<std::array<var, table_size>> tables;
+
+                    std::vector<std::reference_wrapper<var>> all_vars() {
+                        std::vector<std::reference_wrapper<var>> result = {b0, b1};
+                        for (auto &table : tables) {
+                            result.insert(result.end(), table.begin(), table.end());
+                        }
+                        return result;
+                    }
+                };
+
+                struct result_type {
+                    std::vector<var> output;
+
+                    result_type(const window_selection &component, std::uint32_t start_row_index) {
+                        for (std::size_t i = 0; i < component.selections_amount; i++) {
+                            output.push_back(var(component.W(2 + (i % slots_per_row) * slot_size + table_size),
+                                                 start_row_index + i / slots_per_row, false));
+                        }
+                    }
+
+                    std::vector<std::reference_wrapper<var>> all_vars() {
+                        std::vector<std::reference_wrapper<var>> result;
+                        result.insert(result.end(), output.begin(), output.end());
+                        return result;
+                    }
+                };
+
+                template<typename WitnessContainerType, typename ConstantContainerType,
+                         typename PublicInputContainerType>
+                window_selection(WitnessContainerType witness, ConstantContainerType constant,
+                                 PublicInputContainerType public_input, std::size_t selections_amount_) :
+                    component_type(witness, constant, public_input, get_manifest(selections_amount_)),
+                    selections_amount(selections_amount_) {};
+
+                window_selection(
+                    std::initializer_list<typename component_type::witness_container_type::value_type> witnesses,
+                    std::initializer_list<typename component_type::constant_container_type::value_type> constants,
+                    std::initializer_list<typename component_type::public_input_container_type::value_type>
+                        public_inputs,
+                    std::size_t selections_amount_) :
+                    component_type(witnesses, constants, public_inputs, get_manifest(selections_amount_)),
+                    selections_amount(selections_amount_) {};
+            };
+
+            template<typename BlueprintFieldType>
+            using plonk_window_selection =
+                window_selection<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                    BlueprintFieldType>;
+
+            template<typename BlueprintFieldType>
+            std::size_t generate_gates(
+                const plonk_window_selection<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_window_selection<BlueprintFieldType>::input_type &instance_input) {
+
+                using component_type = plonk_window_selection<BlueprintFieldType>;
+                using var = typename component_type::var;
+                using constraint_type = crypto3::zk::snark::plonk_constraint<BlueprintFieldType>;
+
+                const auto b0 = var(component.W(0), 0);
+                const auto b1 = var(component.W(1), 0);
+
+                std::vector<constraint_type> constraints;
+                for (std::size_t slot = 0; slot < component_type::slots_per_row; slot++) {
+                    const std::size_t base = 2 + slot * component_type::slot_size;
+                    const auto t0 = var(component.W(base), 0);
+                    const auto t1 = var(component.W(base + 1), 0);
+                    const auto t2 = var(component.W(base + 2), 0);
+                    const auto t3 = var(component.W(base + 3), 0);
+                    const auto out = var(component.W(base + 4), 0);
+                    constraints.push_back(out - t0 - (t1 - t0) * b0 - (t2 - t0) * b1 - (t3 - t2 - t1 + t0) * b0 * b1);
+                }
+                return bp.add_gate(constraints);
+            }
+
+            template<typename BlueprintFieldType>
+            void generate_copy_constraints(
+                const plonk_window_selection<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_window_selection<BlueprintFieldType>::input_type &instance_input,
+                const std::size_t start_row_index) {
+
+                using component_type = plonk_window_selection<BlueprintFieldType>;
+                using var = typename component_type::var;
+
+                for (std::size_t row = 0; row < component.rows_amount; row++) {
+                    bp.add_copy_constraint({instance_input.b0, var(component.W(0), start_row_index + row, false)});
+                    bp.add_copy_constraint({instance_input.b1, var(component.W(1), start_row_index + row, false)});
+                }
+                for (std::size_t i = 0; i < instance_input.tables.size(); i++) {
+                    const std::size_t row = start_row_index + i / component_type::slots_per_row;
+                    const std::size_t base = 2 + (i % component_type::slots_per_row) * component_type::slot_size;
+                    for (std::size_t j = 0; j < component_type::table_size; j++) {
+                        bp.add_copy_constraint({instance_input.tables[i][j], var(component.W(base + j), row, false)});
+                    }
+                }
+            }
+
+            template<typename BlueprintFieldType>
+            typename plonk_window_selection<BlueprintFieldType>::result_type
+            generate_circuit(
+                const plonk_window_selection<BlueprintFieldType> &component,
+                circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_window_selection<BlueprintFieldType>::input_type &instance_input,
+                const std::uint32_t start_row_index) {
+
+                std::size_t selector_index = generate_gates(component, bp, assignment, instance_input);
+                assignment.enable_selector(selector_index, start_row_index, start_row_index + component.rows_amount - 1);
+                generate_copy_constraints(component, bp, assignment, instance_input, start_row_index);
+
+                return typename plonk_window_selection<BlueprintFieldType>::result_type(component, start_row_index);
+            }
+
+            template<typename BlueprintFieldType>
+            typename plonk_window_selection<BlueprintFieldType>::result_type
+            generate_assignments(
+                const plonk_window_selection<BlueprintFieldType> &component,
+                assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                const typename plonk_window_selection<BlueprintFieldType>::input_type &instance_input,
+                const std::uint32_t start_row_index) {
+
+                using component_type = plonk_window_selection<BlueprintFieldType>;
+                using value_type = typename BlueprintFieldType::value_type;
+
+                const value_type b0 = var_value(assignment, instance_input.b0);
+                const value_type b1 = var_value(assignment, instance_input.b1);
+                const std::size_t index = (b0 == value_type::one() ? 1 : 0) + (b1 == value_type::one() ? 2 : 0);
+
+                for (std::size_t row = 0; row < component.rows_amount; row++) {
+                    assignment.witness(component.W(0), start_row_index + row) = b0;
+                    assignment.witness(component.W(1), start_row_index + row) = b1;
+                    for (std::size_t k = 2; k < component.witness_amount(); k++) {
+                        assignment.witness(component.W(k), start_row_index + row) = value_type::zero();
+                    }
+                }
+                for (std::size_t i = 0; i < instance_input.tables.size(); i++) {
+                    const std::size_t row = start_row_index + i / component_type::slots_per_row;
+                    const std::size_t base = 2 + (i % component_type::slots_per_row) * component_type::slot_size;
+                    for (std::size_t j = 0; j < component_type::table_size; j++) {
+                        assignment.witness(component.W(base + j), row) = var_value(assignment, instance_input.tables[i][j]);
+                    }
+                    assignment.witness(component.W(base + component_type::table_size), row) =
+                        var_value(assignment, instance_input.tables[i][index]);
+                }
+
+                return typename plonk_window_selection<BlueprintFieldType>::result_type(component, start_row_index);
+            }
+        }    // namespace components
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_COMPONENTS_WINDOW_SELECTION_HPP_
@@ -0,0 +1,238 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_CURVES_MSM_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_CURVES_MSM_HPP_
+
+#include "llvm/IR/Type.h"
+#include "llvm/IR/TypeFinder.h"
+#include "llvm/IR/TypedPointerType.h"
+
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+
+#include <nil/blueprint/handle_component.hpp>
+#include <nil/blueprint/extract_constructor_parameters.hpp>
+#include <nil/blueprint/memory.hpp>
+#include <nil/blueprint/non_native_marshalling.hpp>
+#include <nil/blueprint/components/window_selection.hpp>
+
+namespace nil {
+    namespace blueprint {
+        namespace detail {
+
+            template<typename BlueprintFieldType, typename CurveType, typename Ed25519Type>
+            std::vector<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>>
+                handle_non_native_curve_points_addition(
+                    const std::vector<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &P,
+                    const std::vector<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &Q,
+                    circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                    assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+                        &assignment,
+                    column_type<BlueprintFieldType> &internal_storage,
+                    component_calls &statistics,
+                    const common_component_parameters& param) {
+
+                using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
+
+                using ArithmetizationType = crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+                using component_type = components::complete_addition<ArithmetizationType, CurveType,
+                            Ed25519Type, basic_non_native_policy<BlueprintFieldType>>;
+                using non_native_var_type = typename basic_non_native_policy<BlueprintFieldType>::template
+                    field<typename Ed25519Type::base_field_type>::non_native_var_type;
+
+                const std::size_t limbs_amount = P.size() / 2;
+                non_native_var_type P_X, P_Y, Q_X, Q_Y;
+                std::copy(P.begin(), P.begin() + limbs_amount, P_X.begin());
+                std::copy(P.begin() + limbs_amount, P.end(), P_Y.begin());
+                std::copy(Q.begin(), Q.begin() + limbs_amount, Q_X.begin());
+                std::copy(Q.begin() + limbs_amount, Q.end(), Q_Y.begin());
+
+                typename component_type::input_type addition_input = {{P_X, P_Y}, {Q_X, Q_Y}};
+                auto sum = get_component_result<BlueprintFieldType, component_type>
+                    (bp, assignment, internal_storage, statistics, param, addition_input);
+
+                std::vector<var> result;
+                for (const var &v : sum.all_vars()) {
+                    result.push_back(v);
+                }
+                return result;
+            }
+
+            /**
+             * @brief sum [b_i]P_i over points and scalars in memory, Straus method with 2-bit windows.
+             *
+             * Every point gets a table {O, P, 2P, 3P}, then the windows are processed from the top and the
+             * accumulator is doubled twice per window, so doublings are shared by all points and
+             * the cost of an extra point is one selection and one addition per window.
+             */
+            template<typename BlueprintFieldType, typename CurveType, typename Ed25519Type>
+            std::vector<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>>
+                handle_non_native_curve_msm_component(
+                    const std::vector<std::vector<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>>> &points,
+                    const std::vector<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &scalars,
+                    circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                    assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+                        &assignment,
+                    column_type<BlueprintFieldType> &internal_storage,
+                    component_calls &statistics,
+                    const common_component_parameters& param) {
+
+                using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
+                using value_type = typename BlueprintFieldType::value_type;
+
+                using ArithmetizationType = crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+                using decomposition_type = components::bit_decomposition<ArithmetizationType>;
+                using selection_type = components::window_selection<ArithmetizationType, BlueprintFieldType>;
+                using non_native_field_type = typename Ed25519Type::base_field_type;
+
+                constexpr const std::size_t scalar_bits = 253;
+                constexpr const std::size_t window_bits = 2;
+                constexpr const std::size_t windows_amount = (scalar_bits + window_bits - 1) / window_bits;
+
+                ASSERT(points.size() == scalars.size() && !points.empty());
+                const std::size_t limbs_amount = points[0].size() / 2;
+
+                auto add = [&](const std::vector<var> &P, const std::vector<var> &Q) {
+                    return handle_non_native_curve_points_addition<BlueprintFieldType, CurveType, Ed25519Type>
+                        (P, Q, bp, assignment, internal_storage, statistics, param);
+                };
+
+                const var zero = put_constant<value_type, BlueprintFieldType, var>(value_type::zero(), assignment);
+                std::vector<var> identity(2 * limbs_amount, zero);
+                const auto one_limbs = value_into_vector<BlueprintFieldType, non_native_field_type>(
+                    non_native_field_type::value_type::one());
+                for (std::size_t i = 0; i < limbs_amount; i++) {
+                    if (one_limbs[i] != value_type::zero()) {
+                        identity[limbs_amount + i] = put_constant<value_type, BlueprintFieldType, var>(one_limbs[i], assignment);
+                    }
+                }
+
+                std::vector<std::vector<var>> bits;
+                std::vector<std::array<std::vector<var>, 4>> tables;
+                for (std::size_t i = 0; i < points.size(); i++) {
+                    typename decomposition_type::input_type decomposition_input = {scalars[i]};
+                    bits.push_back(get_component_result<BlueprintFieldType, decomposition_type>
+                        (bp, assignment, internal_storage, statistics, param, decomposition_input, scalar_bits,
+                         components::bit_composition_mode::LSB).output);
+                    bits.back().resize(windows_amount * window_bits, zero);
+
+                    const std::vector<var> doubled = add(points[i], points[i]);
+                    tables.push_back({identity, points[i], doubled, add(doubled, points[i])});
+                }
+
+                std::vector<var> result;
+                for (std::size_t window = windows_amount; window-- > 0;) {
+                    if (!result.empty()) {
+                        for (std::size_t i = 0; i < window_bits; i++) {
+                            result = add(result, result);
+                        }
+                    }
+                    for (std::size_t i = 0; i < points.size(); i++) {
+                        typename selection_type::input_type selection_input;
+                        selection_input.b0 = bits[i][window * window_bits];
+                        selection_input.b1 = bits[i][window * window_bits + 1];
+                        selection_input.tables.resize(2 * limbs_amount);
+                        for (std::size_t limb = 0; limb < 2 * limbs_amount; limb++) {
+                            for (std::size_t d = 0; d < selection_type::table_size; d++) {
+                                selection_input.tables[limb][d] = tables[i][d][limb];
+                            }
+                        }
+                        std::vector<var> selected = get_component_result<BlueprintFieldType, selection_type>
+                            (bp, assignment, internal_storage, statistics, param, selection_input, 2 * limbs_amount).output;
+                        result = result.empty() ? selected : add(result, selected);
+                    }
+                }
+                return result;
+            }
+        }    // namespace detail
+
+        template<typename BlueprintFieldType>
+        void handle_curve_msm_component(
+            const llvm::Instruction *inst,
+            stack_frame<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &frame,
+            program_memory<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &memory,
+            circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+            assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+                &assignment,
+            column_type<BlueprintFieldType> &internal_storage,
+            component_calls &statistics,
+            const common_component_parameters& param) {
+
+            using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
+            using non_native_policy_type = basic_non_native_policy<BlueprintFieldType>;
+
+            llvm::Type *curve_type = inst->getType();
+            const std::size_t amount = detail::extract_constant_size_t_value<BlueprintFieldType>(inst->getOperand(2));
+            const std::size_t point_cells = curve_arg_num<BlueprintFieldType>(curve_type);
+
+            auto resolve_ptr = [&](llvm::Value *value) {
+                return static_cast<ptr_type>(typename BlueprintFieldType::integral_type(
+                    detail::var_value<BlueprintFieldType, var>(frame.scalars[value], assignment, internal_storage,
+                        param.gen_mode.has_assignments()).data));
+            };
+            ptr_type points_ptr = resolve_ptr(inst->getOperand(0));
+            ptr_type scalars_ptr = resolve_ptr(inst->getOperand(1));
+
+            std::vector<std::vector<var>> points(amount);
+            std::vector<var> scalars(amount);
+            for (std::size_t i = 0; i < amount; i++) {
+                for (std::size_t j = 0; j < point_cells; j++) {
+                    points[i].push_back(memory.load(points_ptr++));
+                    ASSERT(detail::is_initialized<var>(points[i].back()));
+                }
+                scalars[i] = memory.load(scalars_ptr++);
+                ASSERT(detail::is_initialized<var>(scalars[i]));
+            }
+
+            switch (llvm::cast<llvm::EllipticCurveType>(curve_type)->getCurveKind()) {
+                case llvm::ELLIPTIC_CURVE_CURVE25519: {
+                    using operating_curve_type = typename crypto3::algebra::curves::ed25519;
+                    using operating_field_type = operating_curve_type::base_field_type;
+                    using pallas_curve_type = typename crypto3::algebra::curves::pallas;
+
+                    if constexpr (non_native_policy_type::template field<operating_field_type>::ratio == 0) {
+                        UNREACHABLE("non_native_policy is not implemented yet");
+                    } else {
+                        if (!std::is_same<BlueprintFieldType, pallas_curve_type::base_field_type>::value) {
+                            UNREACHABLE("pallas_curve_type is used as template parameter, if BlueprintFieldType is not pallas::base_field_type, then code must be re-written");
+                        }
+                        std::vector<var> res =
+                            detail::handle_non_native_curve_msm_component<BlueprintFieldType, pallas_curve_type, operating_curve_type>(
+                                points, scalars, bp, assignment, internal_storage, statistics, param);
+                        handle_result<BlueprintFieldType>(assignment, inst, frame, res, param.gen_mode);
+                    }
+                    break;
+                }
+
+                default:
+                    UNREACHABLE("msm is implemented only for curve25519");
+            };
+        }
+
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_CURVES_MSM_HPP_
@@ -37,6 +37,8 @@
 #include <nil/crypto3/algebra/curves/vesta.hpp>
 
 #include <nil/blueprint/handle_component.hpp>
+#include <nil/blueprint/non_native_marshalling.hpp>
+#include <nil/blueprint/components/window_selection.hpp>
 
 namespace nil {
     namespace blueprint {
@@ -127,6 +129,127 @@ namespace nil {
                      253, nil::blueprint::components::bit_composition_mode::MSB);
             }
 
+            /// @brief Whether all limbs are in constant columns. Internal storage is a constant column too,
+            /// but its values are computed from the input, so such a point is not fixed in the circuit.
+            template<typename BlueprintFieldType>
+            bool is_constant_point(const std::vector<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &point) {
+                using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
+                return std::all_of(point.begin(), point.end(),
+                                   [](const var &v) { return v.type == var::column_type::constant && !is_internal<var>(v); });
+            }
+
+            /**
+             * @brief [b]P for a point P fixed in the circuit, 2-bit windows over precomputed multiples of P.
+             *
+             * Window j selects d * 4^j * P, d in 0..3, with the limbs of all four multiples taken from constants,
+             * and the selected points are summed by complete additions. The identity is a valid input of
+             * complete addition, so no offsets are needed and there are no doublings at all.
+             */
+            template<typename BlueprintFieldType, typename CurveType, typename Ed25519Type>
+            std::vector<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>>
+                handle_non_native_curve_fixed_base_multiplication_component(
+                    llvm::Value *operand_curve,
+                    llvm::Value *operand_field,
+                    typename std::map<const llvm::Value *, std::vector<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>>> &vectors,
+                    typename std::map<const llvm::Value *, crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &variables,
+                    circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                    assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+                        &assignment,
+                    column_type<BlueprintFieldType> &internal_storage,
+                    component_calls &statistics,
+                    const common_component_parameters& param) {
+
+                using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
+                using value_type = typename BlueprintFieldType::value_type;
+
+                using ArithmetizationType = crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+                using decomposition_type = components::bit_decomposition<ArithmetizationType>;
+                using selection_type = components::window_selection<ArithmetizationType, BlueprintFieldType>;
+                using addition_type = components::complete_addition<ArithmetizationType, CurveType,
+                            Ed25519Type, basic_non_native_policy<BlueprintFieldType>>;
+
+                using non_native_field_type = typename Ed25519Type::base_field_type;
+                using non_native_var_type = typename basic_non_native_policy<BlueprintFieldType>::template
+                    field<non_native_field_type>::non_native_var_type;
+                using point_type = typename Ed25519Type::template g1_type<crypto3::algebra::curves::coordinates::affine>::value_type;
+
+                constexpr const std::size_t scalar_bits = 253;
+                constexpr const std::size_t window_bits = 2;
+                constexpr const std::size_t windows_amount = (scalar_bits + window_bits - 1) / window_bits;
+
+                const std::vector<var> &point_vars = vectors[operand_curve];
+                const std::size_t limbs_amount = point_vars.size() / 2;
+
+                auto read_coordinate = [&](std::size_t offset) {
+                    column_type<BlueprintFieldType> limbs;
+                    for (std::size_t i = 0; i < limbs_amount; i++) {
+                        limbs.push_back(var_value<BlueprintFieldType, var>(point_vars[offset + i], assignment, internal_storage, true));
+                    }
+                    return typename non_native_field_type::value_type(typename non_native_field_type::integral_type(
+                        vector_into_value<BlueprintFieldType, non_native_field_type>(limbs)));
+                };
+                const point_type P(read_coordinate(0), read_coordinate(limbs_amount));
+
+                // limbs repeat a lot (identity, small multiples), constants are shared between windows
+                std::map<typename BlueprintFieldType::integral_type, var> constants;
+                auto constant_var = [&](const value_type &value) {
+                    const typename BlueprintFieldType::integral_type key(value.data);
+                    auto it = constants.find(key);
+                    if (it == constants.end()) {
+                        it = constants.emplace(key, put_constant<value_type, BlueprintFieldType, var>(value, assignment)).first;
+                    }
+                    return it->second;
+                };
+
+                typename decomposition_type::input_type decomposition_input = {variables[operand_field]};
+                std::vector<var> bits = get_component_result<BlueprintFieldType, decomposition_type>
+                    (bp, assignment, internal_storage, statistics, param, decomposition_input, scalar_bits,
+                     components::bit_composition_mode::LSB).output;
+                bits.resize(windows_amount * window_bits, constant_var(value_type::zero()));
+
+                std::vector<var> result;
+                point_type base = P;
+                for (std::size_t window = 0; window < windows_amount; window++) {
+                    const std::array<point_type, 4> multiples = {
+                        point_type::zero(), base, base.doubled(), base.doubled() + base};
+
+                    typename selection_type::input_type selection_input;
+                    selection_input.b0 = bits[window * window_bits];
+                    selection_input.b1 = bits[window * window_bits + 1];
+                    selection_input.tables.resize(2 * limbs_amount);
+                    for (std::size_t d = 0; d < multiples.size(); d++) {
+                        const auto x = value_into_vector<BlueprintFieldType, non_native_field_type>(multiples[d].X);
+                        const auto y = value_into_vector<BlueprintFieldType, non_native_field_type>(multiples[d].Y);
+                        for (std::size_t i = 0; i < limbs_amount; i++) {
+                            selection_input.tables[i][d] = constant_var(x[i]);
+                            selection_input.tables[limbs_amount + i][d] = constant_var(y[i]);
+                        }
+                    }
+                    std::vector<var> selected = get_component_result<BlueprintFieldType, selection_type>
+                        (bp, assignment, internal_storage, statistics, param, selection_input, 2 * limbs_amount).output;
+
+                    if (window == 0) {
+                        result = selected;
+                    } else {
+                        non_native_var_type T_X, T_Y, R_X, R_Y;
+                        std::copy(result.begin(), result.begin() + limbs_amount, T_X.begin());
+                        std::copy(result.begin() + limbs_amount, result.end(), T_Y.begin());
+                        std::copy(selected.begin(), selected.begin() + limbs_amount, R_X.begin());
+                        std::copy(selected.begin() + limbs_amount, selected.end(), R_Y.begin());
+
+                        typename addition_type::input_type addition_input = {{T_X, T_Y}, {R_X, R_Y}};
+                        auto sum = get_component_result<BlueprintFieldType, addition_type>
+                            (bp, assignment, internal_storage, statistics, param, addition_input);
+                        result.clear();
+                        for (const var &v : sum.all_vars()) {
+                            result.push_back(v);
+                        }
+                    }
+                    base = base.doubled().doubled();
+                }
+                return result;
+            }
+
         }    // namespace detail
 
         template<typename BlueprintFieldType>
@@ -219,6 +342,19 @@ namespace nil {
 
                         if (std::is_same<BlueprintFieldType, operating_field_type>::value) {
                             UNREACHABLE("native curve25519 multiplication is not implemented");
+                        } else if (detail::is_constant_point<BlueprintFieldType>(frame.vectors[operand_curve])) {
+                            std::vector<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> res =
+                                detail::handle_non_native_curve_fixed_base_multiplication_component<BlueprintFieldType, pallas_curve_type, operating_curve_type>(
+                                    operand_curve,
+                                    operand_field,
+                                    frame.vectors,
+                                    frame.scalars,
+                                    bp,
+                                    assignment,
+                                    internal_storage,
+                                    statistics,
+                                    param);
+                            handle_result<BlueprintFieldType>(assignment, inst, frame, res, param.gen_mode);
                         } else {
                             using ArithmetizationType = crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
                             using component_type = components::variable_base_multiplication<ArithmetizationType, pallas_curve_type,
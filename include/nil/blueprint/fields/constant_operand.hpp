@@ -0,0 +1,191 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_FIELDS_CONSTANT_OPERAND_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_FIELDS_CONSTANT_OPERAND_HPP_
+
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/Instructions.h"
+
+#include <nil/blueprint/folding.hpp>
+#include <nil/blueprint/handle_component.hpp>
+#include <nil/blueprint/non_native_marshalling.hpp>
+
+#include <nil/blueprint/components/constant_affine.hpp>
+
+namespace nil {
+    namespace blueprint {
+        namespace detail {
+
+            inline bool is_scalar_constant(const llvm::Value *v) {
+                return llvm::isa<llvm::ConstantField>(v) || llvm::isa<llvm::ConstantInt>(v);
+            }
+
+            /// @brief Whether `inst` has exactly one operand which is a scalar compile-time constant.
+            inline bool has_single_constant_operand(const llvm::Instruction *inst) {
+                return is_scalar_constant(inst->getOperand(0)) != is_scalar_constant(inst->getOperand(1));
+            }
+
+            /**
+             * @brief `mul` by a constant which is placed together with its user as a single `a * x + b`.
+             *
+             * This is the case if its only user is `add` or `sub` of a constant in the same basic block,
+             * so the product is not used anywhere else and is consumed right after it is computed.
+             */
+            inline bool is_fused_affine_multiplication(const llvm::Value *value) {
+                const auto *inst = llvm::dyn_cast<llvm::Instruction>(value);
+                if (inst == nullptr || inst->getOpcode() != llvm::Instruction::Mul ||
+                    !has_single_constant_operand(inst) || !inst->hasOneUse()) {
+                    return false;
+                }
+                const auto *user = llvm::dyn_cast<llvm::Instruction>(*inst->user_begin());
+                return user != nullptr && user->getParent() == inst->getParent() &&
+                       (user->getOpcode() == llvm::Instruction::Add || user->getOpcode() == llvm::Instruction::Sub) &&
+                       has_single_constant_operand(user);
+            }
+
+            /**
+             * @brief Whether the constant operand of `inst` is taken by value and needs no cell in the table.
+             *
+             * This is the case for native field `add`, `sub` and `mul` of a variable and a constant: `add` and `sub`
+             * keep the constant in a linear expression, `mul` keeps it in the affine map. A variable which is
+             * a constant cell itself is excluded, such instructions are folded and need both operands in cells.
+             */
+            template<typename BlueprintFieldType>
+            bool takes_constant_operand_by_value(
+                const llvm::Instruction *inst,
+                const stack_frame<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &frame) {
+
+                using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
+
+                switch (inst->getOpcode()) {
+                    case llvm::Instruction::Add:
+                    case llvm::Instruction::Sub:
+                    case llvm::Instruction::Mul:
+                        break;
+                    default:
+                        return false;
+                }
+                if (!is_native_field<BlueprintFieldType>(inst->getOperand(0)->getType()) ||
+                    !has_single_constant_operand(inst)) {
+                    return false;
+                }
+                const llvm::Value *variable_operand =
+                    inst->getOperand(is_scalar_constant(inst->getOperand(0)) ? 1 : 0);
+                const auto variable = frame.scalars.find(variable_operand);
+                return variable == frame.scalars.end() || variable->second.type != var::column_type::constant;
+            }
+
+            /**
+             * @brief Handle native `add`, `sub` or `mul` with exactly one compile-time constant operand.
+             *
+             * The instruction is placed as `a * x + b`, coefficients are kept in the constant column of the
+             * component row instead of a generic two-input component copy-constrained to a materialized
+             * constant. A fused `mul` (see `is_fused_affine_multiplication`) is not placed at all, its
+             * coefficient goes to the affine map of the `add` or `sub` which uses it.
+             *
+             * @return false if the instruction has no single constant operand and must be handled generically
+             */
+            template<typename BlueprintFieldType>
+            bool handle_native_field_constant_operand_component(
+                const llvm::Instruction *inst,
+                stack_frame<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &frame,
+                circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+                    &assignment,
+                column_type<BlueprintFieldType> &internal_storage,
+                component_calls &statistics,
+                const common_component_parameters& param) {
+
+                using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
+                using value_type = typename BlueprintFieldType::value_type;
+
+                using component_type = components::plonk_constant_affine<BlueprintFieldType>;
+
+                if (!has_single_constant_operand(inst)) {
+                    return false;
+                }
+
+                const bool constant0 = is_scalar_constant(inst->getOperand(0));
+                const llvm::Value *constant_operand = inst->getOperand(constant0 ? 0 : 1);
+                const llvm::Value *variable_operand = inst->getOperand(constant0 ? 1 : 0);
+
+                column_type<BlueprintFieldType> marshalled_constant = marshal_field_val<BlueprintFieldType>(constant_operand);
+                if (marshalled_constant.size() != 1) {
+                    return false;
+                }
+                const value_type c = marshalled_constant[0];
+
+                // x is multiplied by a and c is added to the product
+                value_type a = value_type::one();
+                value_type b = value_type::zero();
+                switch (inst->getOpcode()) {
+                    case llvm::Instruction::Mul: {
+                        if (is_fused_affine_multiplication(inst)) {
+                            // the value of a previous evaluation of the block must not be taken by the user
+                            frame.scalars.erase(inst);
+                            return true;
+                        }
+                        a = c;
+                        break;
+                    }
+                    case llvm::Instruction::Add: {
+                        b = c;
+                        break;
+                    }
+                    case llvm::Instruction::Sub: {
+                        // x - c == x + (-c), c - x == -1 * x + c
+                        a = constant0 ? -value_type::one() : value_type::one();
+                        b = constant0 ? c : -c;
+                        break;
+                    }
+                    default:
+                        return false;
+                }
+
+                if (inst->getOpcode() != llvm::Instruction::Mul && is_fused_affine_multiplication(variable_operand)) {
+                    // (m * x) + b, b - (m * x), (m * x) - b
+                    const auto *multiplication = llvm::cast<llvm::Instruction>(variable_operand);
+                    const bool mul_constant0 = is_scalar_constant(multiplication->getOperand(0));
+                    column_type<BlueprintFieldType> multiplier =
+                        marshal_field_val<BlueprintFieldType>(multiplication->getOperand(mul_constant0 ? 0 : 1));
+                    ASSERT(multiplier.size() == 1);
+                    a *= multiplier[0];
+                    variable_operand = multiplication->getOperand(mul_constant0 ? 1 : 0);
+                }
+
+                typename component_type::input_type instance_input = {frame.scalars[variable_operand]};
+                auto res = get_component_result<BlueprintFieldType, component_type>(
+                    bp, assignment, internal_storage, statistics, param, instance_input, a, b);
+                handle_component_result<BlueprintFieldType, component_type>(
+                    assignment, inst, frame, res, param.gen_mode);
+                return true;
+            }
+
+        }    // namespace detail
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_FIELDS_CONSTANT_OPERAND_HPP_
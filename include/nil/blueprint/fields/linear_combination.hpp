@@ -0,0 +1,228 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_FIELDS_LINEAR_COMBINATION_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_FIELDS_LINEAR_COMBINATION_HPP_
+
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/Instructions.h"
+
+#include <nil/blueprint/handle_component.hpp>
+#include <nil/blueprint/non_native_marshalling.hpp>
+
+#include <nil/blueprint/components/linear_combination.hpp>
+#include <nil/blueprint/fields/constant_operand.hpp>
+
+namespace nil {
+    namespace blueprint {
+        namespace detail {
+
+            /**
+             * @brief Instructions which take pending linear expressions as they are, see `linear_expression`.
+             *
+             * Any other instruction gets its operands materialized before it is handled.
+             */
+            inline bool keeps_linear_expressions(const llvm::Instruction *inst) {
+                switch (inst->getOpcode()) {
+                    case llvm::Instruction::Add:
+                    case llvm::Instruction::Sub:
+                        return inst->getOperand(0)->getType()->isFieldTy();
+                    case llvm::Instruction::PHI:
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+
+            template<typename BlueprintFieldType>
+            linear_expression<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>>
+                linear_operand(
+                    const llvm::Value *operand,
+                    stack_frame<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &frame) {
+
+                linear_expression<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> result;
+
+                auto pending = frame.linear_expressions.find(operand);
+                if (pending != frame.linear_expressions.end()) {
+                    result = pending->second;
+                } else if (llvm::isa<llvm::ConstantField>(operand) || llvm::isa<llvm::ConstantInt>(operand)) {
+                    column_type<BlueprintFieldType> marshalled_constant = marshal_field_val<BlueprintFieldType>(operand);
+                    ASSERT(marshalled_constant.size() == 1);
+                    result.constant = marshalled_constant[0];
+                } else {
+                    ASSERT(frame.scalars.find(operand) != frame.scalars.end());
+                    result.terms.push_back({frame.scalars[operand], false});
+                }
+                return result;
+            }
+
+            template<typename BlueprintFieldType>
+            crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>
+                materialize_linear_expression(
+                    const linear_expression<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &expression,
+                    circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                    assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+                        &assignment,
+                    column_type<BlueprintFieldType> &internal_storage,
+                    component_calls &statistics,
+                    const common_component_parameters& param) {
+
+                using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
+                using component_type = components::plonk_linear_combination<BlueprintFieldType>;
+                using addition_type = components::addition<
+                    crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                    BlueprintFieldType, basic_non_native_policy<BlueprintFieldType>>;
+                using subtraction_type = components::subtraction<
+                    crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                    BlueprintFieldType, basic_non_native_policy<BlueprintFieldType>>;
+
+                if (expression.terms.empty()) {
+                    return put_constant<typename BlueprintFieldType::value_type, BlueprintFieldType, var>(
+                        expression.constant, assignment);
+                }
+                if (expression.terms.size() == 1 && !expression.terms[0].second && expression.constant.is_zero()) {
+                    return expression.terms[0].first;
+                }
+                // x + y and x - y are placed by the components the packing policy shares rows between
+                if (expression.terms.size() == 2 && expression.constant.is_zero() &&
+                    !(expression.terms[0].second && expression.terms[1].second)) {
+                    if (!expression.terms[0].second && !expression.terms[1].second) {
+                        typename addition_type::input_type instance_input({expression.terms[0].first,
+                                                                           expression.terms[1].first});
+                        return get_component_result<BlueprintFieldType, addition_type>(
+                            bp, assignment, internal_storage, statistics, param, instance_input).output;
+                    }
+                    const bool first_negative = expression.terms[0].second;
+                    typename subtraction_type::input_type instance_input(
+                        {expression.terms[first_negative ? 1 : 0].first, expression.terms[first_negative ? 0 : 1].first});
+                    return get_component_result<BlueprintFieldType, subtraction_type>(
+                        bp, assignment, internal_storage, statistics, param, instance_input).output;
+                }
+
+                typename component_type::input_type instance_input;
+                for (const auto &term : expression.terms) {
+                    if (!term.second) {
+                        instance_input.terms.push_back(term.first);
+                    }
+                }
+                const std::size_t positive_amount = instance_input.terms.size();
+                for (const auto &term : expression.terms) {
+                    if (term.second) {
+                        instance_input.terms.push_back(term.first);
+                    }
+                }
+                const std::size_t negative_amount = instance_input.terms.size() - positive_amount;
+
+                return get_component_result<BlueprintFieldType, component_type>(
+                    bp, assignment, internal_storage, statistics, param, instance_input,
+                    positive_amount, negative_amount, expression.constant).output;
+            }
+
+            /**
+             * @brief Place pending linear expression of `operand` into the circuit, if there is one.
+             */
+            template<typename BlueprintFieldType>
+            void materialize_linear_operand(
+                const llvm::Value *operand,
+                stack_frame<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &frame,
+                circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+                    &assignment,
+                column_type<BlueprintFieldType> &internal_storage,
+                component_calls &statistics,
+                const common_component_parameters& param) {
+
+                auto pending = frame.linear_expressions.find(operand);
+                if (pending == frame.linear_expressions.end()) {
+                    return;
+                }
+                frame.scalars[operand] = materialize_linear_expression<BlueprintFieldType>(
+                    pending->second, bp, assignment, internal_storage, statistics, param);
+                frame.linear_expressions.erase(pending);
+            }
+
+            /**
+             * @brief Handle native field `add` or `sub` lazily.
+             *
+             * The result is kept as a pending linear expression of the operands, so a chain of additions and
+             * subtractions is placed as a single linear combination when its value is used by anything else.
+             * A plain `x + y` or `x - y` is placed by the addition or subtraction component instead.
+             * An expression is materialized earlier only if it does not fit into the witness columns.
+             * `a * x + b` is placed at once as an affine map.
+             */
+            template<typename BlueprintFieldType>
+            void handle_native_field_linear_component(
+                const llvm::Instruction *inst,
+                stack_frame<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &frame,
+                circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+                    &assignment,
+                column_type<BlueprintFieldType> &internal_storage,
+                component_calls &statistics,
+                const common_component_parameters& param) {
+
+                ASSERT(inst->getOpcode() == llvm::Instruction::Add || inst->getOpcode() == llvm::Instruction::Sub);
+
+                const llvm::Value *operand0 = inst->getOperand(0);
+                const llvm::Value *operand1 = inst->getOperand(1);
+
+                // the product is not computed, see `is_fused_affine_multiplication`
+                if (is_fused_affine_multiplication(operand0) || is_fused_affine_multiplication(operand1)) {
+                    const bool handled = handle_native_field_constant_operand_component<BlueprintFieldType>(
+                        inst, frame, bp, assignment, internal_storage, statistics, param);
+                    ASSERT(handled);
+                    return;
+                }
+
+                // one witness column is taken by the result
+                const std::size_t max_terms_amount = param.policy->get_witness_limit() - 1;
+
+                auto lhs = linear_operand<BlueprintFieldType>(operand0, frame);
+                auto rhs = linear_operand<BlueprintFieldType>(operand1, frame);
+                while (lhs.terms.size() + rhs.terms.size() > max_terms_amount) {
+                    materialize_linear_operand<BlueprintFieldType>(
+                        lhs.terms.size() >= rhs.terms.size() ? operand0 : operand1,
+                        frame, bp, assignment, internal_storage, statistics, param);
+                    lhs = linear_operand<BlueprintFieldType>(operand0, frame);
+                    rhs = linear_operand<BlueprintFieldType>(operand1, frame);
+                }
+
+                const bool subtract = inst->getOpcode() == llvm::Instruction::Sub;
+                for (const auto &term : rhs.terms) {
+                    lhs.terms.push_back({term.first, term.second != subtract});
+                }
+                if (subtract) {
+                    lhs.constant -= rhs.constant;
+                } else {
+                    lhs.constant += rhs.constant;
+                }
+                frame.linear_expressions[inst] = lhs;
+            }
+
+        }    // namespace detail
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_FIELDS_LINEAR_COMBINATION_HPP_
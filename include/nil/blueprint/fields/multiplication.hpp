@@ -37,6 +37,7 @@
 #include <nil/crypto3/algebra/curves/vesta.hpp>
 
 #include <nil/blueprint/handle_component.hpp>
+#include <nil/blueprint/fields/constant_operand.hpp>
 
 namespace nil {
     namespace blueprint {
@@ -142,10 +143,13 @@ namespace nil {
 
                     if constexpr (non_native_policy_type::template field<operating_field_type>::ratio != 0) {
                         if (std::is_same<BlueprintFieldType, operating_field_type>::value) {
-                            auto res = detail::handle_native_field_multiplication_component<BlueprintFieldType>(
-                                                  operand0, operand1, frame.scalars, bp, assignment, internal_storage, statistics, param);
-                            handle_component_result<BlueprintFieldType, native_component_type>
-                                    (assignment, inst, frame, res, param.gen_mode);
+                            if (!detail::handle_native_field_constant_operand_component<BlueprintFieldType>(
+                                    inst, frame, bp, assignment, internal_storage, statistics, param)) {
+                                auto res = detail::handle_native_field_multiplication_component<BlueprintFieldType>(
+                                                      operand0, operand1, frame.scalars, bp, assignment, internal_storage, statistics, param);
+                                handle_component_result<BlueprintFieldType, native_component_type>
+                                        (assignment, inst, frame, res, param.gen_mode);
+                            }
                         } else {
                             UNREACHABLE("non-native bls12-381 base field mul not implemented yet");
                         }
@@ -161,10 +165,13 @@ namespace nil {
 
                     if constexpr (non_native_policy_type::template field<operating_field_type>::ratio != 0) {
                         if (std::is_same<BlueprintFieldType, operating_field_type>::value) {
-                            auto res = detail::handle_native_field_multiplication_component<BlueprintFieldType>(
-                                                  operand0, operand1, frame.scalars, bp, assignment, internal_storage, statistics, param);
-                            handle_component_result<BlueprintFieldType, native_component_type>
-                                    (assignment, inst, frame, res, param.gen_mode);
+                            if (!detail::handle_native_field_constant_operand_component<BlueprintFieldType>(
+                                    inst, frame, bp, assignment, internal_storage, statistics, param)) {
+                                auto res = detail::handle_native_field_multiplication_component<BlueprintFieldType>(
+                                                      operand0, operand1, frame.scalars, bp, assignment, internal_storage, statistics, param);
+                                handle_component_result<BlueprintFieldType, native_component_type>
+                                        (assignment, inst, frame, res, param.gen_mode);
+                            }
                         } else {
                             UNREACHABLE("non-native pallas base field mul not implemented yet");
                         }
@@ -183,10 +190,13 @@ namespace nil {
 
                     if constexpr (non_native_policy_type::template field<operating_field_type>::ratio != 0) {
                         if (std::is_same<BlueprintFieldType, operating_field_type>::value) {
-                            auto res = detail::handle_native_field_multiplication_component<BlueprintFieldType>(
-                                                  operand0, operand1, frame.scalars, bp, assignment, internal_storage, statistics, param);
-                            handle_component_result<BlueprintFieldType, native_component_type>
-                                    (assignment, inst, frame, res, param.gen_mode);
+                            if (!detail::handle_native_field_constant_operand_component<BlueprintFieldType>(
+                                    inst, frame, bp, assignment, internal_storage, statistics, param)) {
+                                auto res = detail::handle_native_field_multiplication_component<BlueprintFieldType>(
+                                                      operand0, operand1, frame.scalars, bp, assignment, internal_storage, statistics, param);
+                                handle_component_result<BlueprintFieldType, native_component_type>
+                                        (assignment, inst, frame, res, param.gen_mode);
+                            }
                         } else {
                             auto component_result = detail::handle_non_native_field_multiplication_component<
                                                        BlueprintFieldType, operating_field_type>(
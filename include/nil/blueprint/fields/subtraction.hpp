@@ -37,6 +37,7 @@
 #include <nil/crypto3/algebra/curves/vesta.hpp>
 
 #include <nil/blueprint/handle_component.hpp>
+#include <nil/blueprint/fields/linear_combination.hpp>
 
 namespace nil {
     namespace blueprint {
@@ -123,9 +124,6 @@ namespace nil {
             const common_component_parameters& param) {
 
             using non_native_policy_type = basic_non_native_policy<BlueprintFieldType>;
-            using native_component_type = components::subtraction<
-                crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
-                BlueprintFieldType, basic_non_native_policy<BlueprintFieldType>>;
 
             llvm::Value *operand0 = inst->getOperand(0);
             llvm::Value *operand1 = inst->getOperand(1);
@@ -142,9 +140,8 @@ namespace nil {
 
                     if constexpr (non_native_policy_type::template field<operating_field_type>::ratio != 0) {
                         if (std::is_same<BlueprintFieldType, operating_field_type>::value) {
-                            auto res = detail::handle_native_field_subtraction_component<BlueprintFieldType>(
-                                                  operand0, operand1, frame.scalars, bp, assignment, internal_storage, statistics, param);
-                            handle_component_result<BlueprintFieldType, native_component_type>(assignment, inst, frame, res, param.gen_mode);
+                            detail::handle_native_field_linear_component<BlueprintFieldType>(
+                                inst, frame, bp, assignment, internal_storage, statistics, param);
                         } else {
                             UNREACHABLE("not implemented yet");
                         }
@@ -160,9 +157,8 @@ namespace nil {
 
                     if constexpr (non_native_policy_type::template field<operating_field_type>::ratio != 0) {
                         if (std::is_same<BlueprintFieldType, operating_field_type>::value) {
-                            auto res = detail::handle_native_field_subtraction_component<BlueprintFieldType>(
-                                                  operand0, operand1, frame.scalars, bp, assignment, internal_storage, statistics, param);
-                            handle_component_result<BlueprintFieldType, native_component_type>(assignment, inst, frame, res, param.gen_mode);
+                            detail::handle_native_field_linear_component<BlueprintFieldType>(
+                                inst, frame, bp, assignment, internal_storage, statistics, param);
                         } else {
                             UNREACHABLE("non_native_policy is not implemented yet");
                         }
@@ -181,9 +177,8 @@ namespace nil {
 
                     if constexpr (non_native_policy_type::template field<operating_field_type>::ratio != 0) {
                         if (std::is_same<BlueprintFieldType, operating_field_type>::value) {
-                            auto res = detail::handle_native_field_subtraction_component<BlueprintFieldType>(
-                                                  operand0, operand1, frame.scalars, bp, assignment, internal_storage, statistics, param);
-                            handle_component_result<BlueprintFieldType, native_component_type>(assignment, inst, frame, res, param.gen_mode);
+                            detail::handle_native_field_linear_component<BlueprintFieldType>(
+                                inst, frame, bp, assignment, internal_storage, statistics, param);
                         } else {
                             auto component_result = detail::handle_non_native_field_subtraction_component<
                                                        BlueprintFieldType, operating_field_type>(
@@ -0,0 +1,247 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_FOLDING_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_FOLDING_HPP_
+
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Type.h"
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+
+#include <nil/blueprint/asserts.hpp>
+#include <nil/blueprint/stack.hpp>
+#include <nil/blueprint/utilities.hpp>
+
+#include <type_traits>
+#include <vector>
+
+namespace nil {
+    namespace blueprint {
+        namespace detail {
+
+            template<typename BlueprintFieldType>
+            bool is_native_field(const llvm::Type *type) {
+                if (!type->isFieldTy()) {
+                    return false;
+                }
+                switch (llvm::cast<llvm::GaloisFieldType>(type)->getFieldKind()) {
+                    case llvm::GALOIS_FIELD_PALLAS_BASE:
+                        return std::is_same<BlueprintFieldType,
+                            typename crypto3::algebra::curves::pallas::base_field_type>::value;
+                    case llvm::GALOIS_FIELD_PALLAS_SCALAR:
+                        return std::is_same<BlueprintFieldType,
+                            typename crypto3::algebra::curves::pallas::scalar_field_type>::value;
+                    case llvm::GALOIS_FIELD_VESTA_BASE:
+                        return std::is_same<BlueprintFieldType,
+                            typename crypto3::algebra::curves::vesta::base_field_type>::value;
+                    case llvm::GALOIS_FIELD_VESTA_SCALAR:
+                        return std::is_same<BlueprintFieldType,
+                            typename crypto3::algebra::curves::vesta::scalar_field_type>::value;
+                    case llvm::GALOIS_FIELD_BLS12381_BASE:
+                        return std::is_same<BlueprintFieldType,
+                            typename crypto3::algebra::curves::bls12<381>::base_field_type>::value;
+                    case llvm::GALOIS_FIELD_BLS12381_SCALAR:
+                        return std::is_same<BlueprintFieldType,
+                            typename crypto3::algebra::curves::bls12<381>::scalar_field_type>::value;
+                    case llvm::GALOIS_FIELD_CURVE25519_BASE:
+                        return std::is_same<BlueprintFieldType,
+                            typename crypto3::algebra::curves::ed25519::base_field_type>::value;
+                    case llvm::GALOIS_FIELD_CURVE25519_SCALAR:
+                        return std::is_same<BlueprintFieldType,
+                            typename crypto3::algebra::curves::ed25519::scalar_field_type>::value;
+                    default:
+                        return false;
+                }
+            }
+
+            /**
+             * @brief Evaluate an instruction on the host if all its operands are known without witnesses.
+             *
+             * Operands are known if they are constants or internal values. The result is computed with
+             * the same semantics as the component which would be used otherwise and is placed into
+             * internal storage if any operand is internal, otherwise into the constant column.
+             * No rows, gates or copy constraints are added.
+             *
+             * @return false if the instruction has to be handled by a component
+             */
+            template<typename BlueprintFieldType>
+            bool fold_instruction(
+                const llvm::Instruction *inst,
+                stack_frame<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &frame,
+                assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignment,
+                column_type<BlueprintFieldType> &internal_storage) {
+
+                using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
+                using value_type = typename BlueprintFieldType::value_type;
+                using integral_type = typename BlueprintFieldType::integral_type;
+
+                switch (inst->getOpcode()) {
+                    case llvm::Instruction::Add:
+                    case llvm::Instruction::Sub:
+                    case llvm::Instruction::Mul:
+                    case llvm::Instruction::UDiv:
+                    case llvm::Instruction::URem:
+                    case llvm::Instruction::Shl:
+                    case llvm::Instruction::LShr:
+                    case llvm::Instruction::And:
+                    case llvm::Instruction::Or:
+                    case llvm::Instruction::Xor:
+                    case llvm::Instruction::ICmp:
+                        break;
+                    default:
+                        return false;
+                }
+
+                llvm::Type *operand_type = inst->getOperand(0)->getType();
+                const bool is_integer = operand_type->isIntegerTy();
+                if (!is_integer && !is_native_field<BlueprintFieldType>(operand_type)) {
+                    return false;
+                }
+
+                bool has_internal = false;
+                std::vector<value_type> values;
+                for (std::size_t i = 0; i < 2; i++) {
+                    const llvm::Value *operand = inst->getOperand(i);
+                    if (frame.linear_expressions.find(operand) != frame.linear_expressions.end()) {
+                        return false;
+                    }
+                    auto it = frame.scalars.find(operand);
+                    if (it == frame.scalars.end() || it->second.type != var::column_type::constant) {
+                        return false;
+                    }
+                    has_internal = has_internal || is_internal<var>(it->second);
+                    values.push_back(var_value<BlueprintFieldType, var>(it->second, assignment, internal_storage, false));
+                }
+
+                const value_type &x = values[0];
+                const value_type &y = values[1];
+                const integral_type x_integral = integral_type(x.data);
+                const integral_type y_integral = integral_type(y.data);
+                const std::size_t bitness = is_integer ? operand_type->getPrimitiveSizeInBits() : 0;
+
+                value_type result;
+                switch (inst->getOpcode()) {
+                    case llvm::Instruction::Add:
+                        result = x + y;
+                        break;
+                    case llvm::Instruction::Sub:
+                        result = x - y;
+                        break;
+                    case llvm::Instruction::Mul:
+                        result = x * y;
+                        break;
+                    case llvm::Instruction::UDiv:
+                        if (y.is_zero()) {
+                            return false;
+                        }
+                        result = is_integer ? value_type(x_integral / y_integral) : x * y.inversed();
+                        break;
+                    case llvm::Instruction::URem:
+                        if (!is_integer || y.is_zero()) {
+                            return false;
+                        }
+                        result = value_type(x_integral % y_integral);
+                        break;
+                    case llvm::Instruction::Shl:
+                    case llvm::Instruction::LShr: {
+                        if (!is_integer || bitness >= BlueprintFieldType::modulus_bits || y_integral >= bitness) {
+                            return false;
+                        }
+                        const std::size_t shift = std::size_t(y_integral);
+                        if (inst->getOpcode() == llvm::Instruction::Shl) {
+                            const integral_type mask = (integral_type(1) << bitness) - 1;
+                            result = value_type((x_integral << shift) & mask);
+                        } else {
+                            result = value_type(x_integral >> shift);
+                        }
+                        break;
+                    }
+                    case llvm::Instruction::And:
+                    case llvm::Instruction::Or:
+                    case llvm::Instruction::Xor:
+                        if (!is_integer) {
+                            return false;
+                        }
+                        if (inst->getOpcode() == llvm::Instruction::And) {
+                            result = value_type(x_integral & y_integral);
+                        } else if (inst->getOpcode() == llvm::Instruction::Or) {
+                            result = value_type(x_integral | y_integral);
+                        } else {
+                            result = value_type(x_integral ^ y_integral);
+                        }
+                        break;
+                    case llvm::Instruction::ICmp: {
+                        // comparison components treat signed predicates as unsigned ones
+                        bool flag = false;
+                        switch (llvm::cast<llvm::ICmpInst>(inst)->getPredicate()) {
+                            case llvm::CmpInst::ICMP_EQ:
+                                flag = x_integral == y_integral;
+                                break;
+                            case llvm::CmpInst::ICMP_NE:
+                                flag = x_integral != y_integral;
+                                break;
+                            case llvm::CmpInst::ICMP_SGE:
+                            case llvm::CmpInst::ICMP_UGE:
+                                flag = x_integral >= y_integral;
+                                break;
+                            case llvm::CmpInst::ICMP_SGT:
+                            case llvm::CmpInst::ICMP_UGT:
+                                flag = x_integral > y_integral;
+                                break;
+                            case llvm::CmpInst::ICMP_SLE:
+                            case llvm::CmpInst::ICMP_ULE:
+                                flag = x_integral <= y_integral;
+                                break;
+                            case llvm::CmpInst::ICMP_SLT:
+                            case llvm::CmpInst::ICMP_ULT:
+                                flag = x_integral < y_integral;
+                                break;
+                            default:
+                                return false;
+                        }
+                        result = flag ? value_type::one() : value_type::zero();
+                        break;
+                    }
+                    default:
+                        UNREACHABLE("unexpected opcode for folding");
+                }
+
+                frame.scalars[inst] = has_internal ?
+                    put_internal_value<value_type, BlueprintFieldType, var>(result, internal_storage) :
+                    put_constant<value_type, BlueprintFieldType, var>(result, assignment);
+                return true;
+            }
+
+        }    // namespace detail
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_FOLDING_HPP_
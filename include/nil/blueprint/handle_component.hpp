@@ -26,6 +26,8 @@
 #ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_HANDLE_COMPONENT_HPP_
 #define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_HANDLE_COMPONENT_HPP_
 
+#include <tuple>
+
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
 #include <nil/blueprint/utilities.hpp>
 
@@ -67,11 +69,12 @@
 #include <nil/blueprint/component_mockups/fp12_multiplication.hpp>
 #include <nil/blueprint/component_mockups/bls12_381_pairing.hpp>
 #include <nil/blueprint/component_mockups/comparison.hpp>
-#include <nil/blueprint/component_mockups/bitwise_and.hpp>
-#include <nil/blueprint/component_mockups/bitwise_or.hpp>
-#include <nil/blueprint/component_mockups/bitwise_xor.hpp>
+#include <nil/blueprint/components/bitwise.hpp>
+#include <nil/blueprint/components/power_of_two.hpp>
+#include <nil/blueprint/components/radix_composition.hpp>
 
 #include <nil/blueprint/asserts.hpp>
+#include <nil/blueprint/replay_log.hpp>
 #include <nil/blueprint/stack.hpp>
 #include <nil/blueprint/statistics.hpp>
 #include <nil/blueprint/policy/policy_manager.hpp>
@@ -87,7 +90,8 @@ namespace nil {
          * - CIRCUIT - generate circuit;
          * - ASSIGNMENTS - generate assignment table;
          * - SIZE_ESTIMATION - print circuit stats (generate nothing);
-         * - PUBLIC_INPUT_COLUMN - generate public input column.
+         * - PUBLIC_INPUT_COLUMN - generate public input column;
+         * - FAST_EVALUATION - compute values only.
          *
          * Binary AND and OR can be applied to modes:
          * `mode_a | mode_b`, `mode_a & mode_b`.
@@ -100,6 +104,7 @@ namespace nil {
                 ASSIGNMENTS = 1 << 1,
                 SIZE_ESTIMATION = 1 << 2,
                 PUBLIC_INPUT_COLUMN = 1 << 3,
+                FAST_EVALUATION = 1 << 4,
             };
 
         public:
@@ -137,6 +142,18 @@ namespace nil {
                 return generation_mode(SIZE_ESTIMATION);
             }
 
+            /**
+             * @brief Compute values only, e.g. to validate input before the real run.
+             *
+             * Inputs are kept as internal values, so that arithmetic on them is folded on the host,
+             * only taken branches are executed and failed exit checks are counted instead of being constrained.
+             * Operations which cannot be folded are computed by components in a throwaway table and their results
+             * are kept as internal values too, so neither gates nor rows of the assignment table are generated.
+             */
+            constexpr static generation_mode fast_evaluation() {
+                return generation_mode(FAST_EVALUATION | ASSIGNMENTS);
+            }
+
             constexpr bool operator==(generation_mode other) const {
                 return mode_ == other.mode_;
             }
@@ -188,6 +205,16 @@ namespace nil {
                 return mode_ & PUBLIC_INPUT_COLUMN;
             }
 
+            /// @brief Whether compute values only or not in this mode.
+            constexpr bool has_fast_evaluation() const {
+                return mode_ & FAST_EVALUATION;
+            }
+
+            /// @brief The same mode with circuit generation turned off.
+            constexpr generation_mode without_circuit() const {
+                return generation_mode(static_cast<uint8_t>(mode_ & ~CIRCUIT));
+            }
+
         private:
             uint8_t mode_;
         };
@@ -195,6 +222,10 @@ namespace nil {
         struct common_component_parameters {
             std::uint32_t target_prover_idx;
             generation_mode gen_mode;
+            // witness generation steps are recorded here if set, see replay_log.hpp
+            replay_log_base *replay = nullptr;
+            // chooses witness amount and placement of components, owned by the assigner
+            detail::Policy *policy = nullptr;
         };
 
         template<typename BlueprintFieldType, typename ComponentType>
@@ -217,7 +248,16 @@ namespace nil {
                            (v.get().type == var::column_type::witness || v.get().type == var::column_type::constant)) {
                     var new_v;
                     if (param.gen_mode.has_assignments()) {
+                        const var original = v.get();
                         new_v = save_shared_var(assignment, v);
+                        if (param.replay != nullptr) {
+                            static_cast<replay_log<BlueprintFieldType> *>(param.replay)->record(
+                                assignment.get_id(),
+                                [original, new_v](typename replay_log<BlueprintFieldType>::assignment_type &replayed) {
+                                    replayed.shared(0, new_v.rotation) = var_value(replayed, original);
+                                    return true;
+                                });
+                        }
                     } else {
                         const auto& shared_idx = assignment.shared_column_size(0);
                         assignment.shared(0, shared_idx) = BlueprintFieldType::value_type::zero();
@@ -297,6 +337,76 @@ namespace nil {
             }
         }
 
+        /**
+         * @brief Compute outputs of the component in FAST_EVALUATION mode.
+         *
+         * Input values are copied into the shared column of a throwaway table, the component is assigned there
+         * and its outputs are returned as internal values, so the real table and circuit are untouched.
+         */
+        template<typename BlueprintFieldType, typename ComponentType>
+        typename ComponentType::result_type evaluate_component_values(
+            const ComponentType& component_instance,
+            const assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+                &assignment,
+            column_type<BlueprintFieldType> &internal_storage,
+            typename ComponentType::input_type& instance_input) {
+
+            using ArithmetizationType = crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+            using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
+
+            assignment_proxy<ArithmetizationType> values(
+                std::make_shared<blueprint::assignment<ArithmetizationType>>(
+                    crypto3::zk::snark::plonk_table_description<BlueprintFieldType>(
+                        assignment.witnesses_amount(), assignment.public_inputs_amount(),
+                        assignment.constants_amount(), assignment.selectors_amount())),
+                assignment.get_id());
+
+            for (auto& v : instance_input.all_vars()) {
+                const auto shared_idx = values.shared_column_size(0);
+                values.shared(0, shared_idx) =
+                    detail::var_value<BlueprintFieldType, var>(v.get(), assignment, internal_storage, true);
+                v.get() = var(1, shared_idx, false, var::column_type::public_input);
+            }
+
+            auto result = components::generate_assignments(component_instance, values, instance_input, 0);
+            for (auto& v : result.all_vars()) {
+                v.get() = detail::put_internal_value<typename BlueprintFieldType::value_type, BlueprintFieldType, var>(
+                    var_value(values, v.get()), internal_storage);
+            }
+            return result;
+        }
+
+        namespace detail {
+            /**
+             * @brief Components which may be placed next to other ones in the same rows.
+             *
+             * Such a component must use neither constant columns nor lookups and its gates must refer
+             * to its own cells only.
+             */
+            template<typename ComponentType>
+            struct is_packable : std::false_type {};
+
+            template<typename BlueprintFieldType>
+            struct is_packable<components::addition<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                               BlueprintFieldType, basic_non_native_policy<BlueprintFieldType>>> : std::true_type {};
+
+            template<typename BlueprintFieldType>
+            struct is_packable<components::subtraction<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                               BlueprintFieldType, basic_non_native_policy<BlueprintFieldType>>> : std::true_type {};
+
+            template<typename BlueprintFieldType>
+            struct is_packable<components::multiplication<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                               BlueprintFieldType, basic_non_native_policy<BlueprintFieldType>>> : std::true_type {};
+
+            template<typename BlueprintFieldType>
+            struct is_packable<components::equality_flag<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                               BlueprintFieldType>> : std::true_type {};
+
+            template<typename BlueprintFieldType>
+            struct is_packable<components::power_of_two<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                               BlueprintFieldType>> : std::true_type {};
+        }    // namespace detail
+
         template<typename BlueprintFieldType, typename ComponentType, typename... Args>
         typename ComponentType::result_type get_component_result(
                 circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
@@ -308,7 +418,26 @@ namespace nil {
                 typename ComponentType::input_type& instance_input,
                 Args... args) {
 
-            const auto p = detail::PolicyManager::get_parameters(detail::ManifestReader<ComponentType>::get_witness(args...));
+            auto p = param.policy->get_parameters(detail::ManifestReader<ComponentType>::get_witness(
+                param.policy->get_restriction_manifest(), args...));
+            const auto rows_amount = ComponentType::get_rows_amount(p.witness.size(), args...);
+
+            // rows are not allocated in size estimation mode, so components are placed after the rows
+            // they would take, the same way as in the real run
+            const std::size_t table_rows = param.gen_mode.has_size_estimation() ?
+                std::max<std::size_t>(statistics.allocated_rows, assignment.allocated_rows()) :
+                assignment.allocated_rows();
+            std::size_t start_row = table_rows;
+            detail::row_packer *packer =
+                detail::is_packable<ComponentType>::value && !param.gen_mode.has_fast_evaluation() ?
+                    param.policy->get_packer() : nullptr;
+            if (packer != nullptr) {
+                const auto placement = packer->place(assignment.get_id(), table_rows, p.witness.size(), rows_amount);
+                start_row = placement.start_row;
+                for (auto &column : p.witness) {
+                    column += placement.column_offset;
+                }
+            }
 
             ComponentType component_instance(
                 p.witness,
@@ -325,26 +454,47 @@ namespace nil {
                     component_instance.gates_amount,
                     component_instance.witness_amount()
                 );
-                return typename ComponentType::result_type(component_instance, assignment.allocated_rows());
+                statistics.allocate_rows(start_row + rows_amount);
+                return typename ComponentType::result_type(component_instance, start_row);
             }
 
-            handle_component_input<BlueprintFieldType, ComponentType>(assignment, instance_input, param);
+            if (param.gen_mode.has_fast_evaluation()) {
+                return evaluate_component_values<BlueprintFieldType, ComponentType>(
+                    component_instance, assignment, internal_storage, instance_input);
+            }
 
-            const auto& start_row = assignment.allocated_rows();
-            // copy constraints before execute component
-            const auto num_copy_constraints = bp.copy_constraints().size();
+            handle_component_input<BlueprintFieldType, ComponentType>(assignment, instance_input, param);
 
             // generate circuit in any case for fill selectors
             generate_circuit(component_instance, bp, assignment, instance_input, start_row);
 
             if (param.gen_mode.has_assignments()) {
+                if (param.replay != nullptr) {
+                    // The component is built again from its witness columns and arguments at replay, so the log
+                    // keeps a few integers per step instead of the component with its manifest and subcomponents
+                    static_cast<replay_log<BlueprintFieldType> *>(param.replay)->record(
+                        assignment.get_id(),
+                        [witness = p.witness, arguments = std::make_tuple(args...), instance_input, start_row,
+                         target_prover_idx = param.target_prover_idx](
+                                typename replay_log<BlueprintFieldType>::assignment_type &replayed) {
+                            std::apply(
+                                [&](const auto &... component_args) {
+                                    const ComponentType replayed_instance(
+                                        witness, std::array<std::uint32_t, 1>{0}, std::array<std::uint32_t, 1>{0},
+                                        component_args...);
+                                    generate_assignments(replayed_instance, replayed, instance_input, start_row,
+                                                         target_prover_idx);
+                                },
+                                arguments);
+                            return true;
+                        });
+                }
                 return generate_assignments(component_instance, assignment, instance_input, start_row,
                                             param.target_prover_idx);
             } else {
-                const auto rows_amount = ComponentType::get_rows_amount(p.witness.size(), args...);
                 // fake allocate rows
                 for (std::uint32_t i = 0; i < rows_amount; i++) {
-                    assignment.witness(0, start_row + i) = BlueprintFieldType::value_type::zero();
+                    assignment.witness(component_instance.W(0), start_row + i) = BlueprintFieldType::value_type::zero();
                 }
                 return typename ComponentType::result_type(component_instance, start_row);
             }
@@ -0,0 +1,123 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_HASHES_POSEIDON_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_HASHES_POSEIDON_HPP_
+
+#include "llvm/IR/Type.h"
+#include "llvm/IR/TypeFinder.h"
+#include "llvm/IR/TypedPointerType.h"
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+
+#include <nil/blueprint/components/hashes/poseidon/plonk/poseidon.hpp>
+
+#include <nil/blueprint/handle_component.hpp>
+#include <nil/blueprint/extract_constructor_parameters.hpp>
+#include <nil/blueprint/fields/linear_combination.hpp>
+#include <nil/blueprint/memory.hpp>
+
+#include <type_traits>
+
+namespace nil {
+    namespace blueprint {
+        namespace detail {
+
+            /// @brief Native fields for which the poseidon component has round constants and MDS matrix.
+            template<typename BlueprintFieldType>
+            struct has_poseidon_parameters : std::false_type {};
+
+            template<>
+            struct has_poseidon_parameters<typename crypto3::algebra::curves::pallas::base_field_type>
+                : std::true_type {};
+        }    // namespace detail
+
+        /**
+         * @brief Absorb `length` field elements starting at a pointer and squeeze one element.
+         *
+         * Rate is state_size - 1 and the last state element is the capacity. The capacity lane of each
+         * permutation is wired straight into the next one, rate lanes pay one linear combination row per
+         * absorbed element. A zero-padded tail chunk reuses the previous state for the padded lanes.
+         * The capacity lane starts from the message length, so messages which differ only in trailing
+         * zeros do not collide. Empty messages are rejected.
+         */
+        template<typename BlueprintFieldType>
+        void handle_poseidon_sponge_component(
+            const llvm::Instruction *inst,
+            stack_frame<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &frame,
+            program_memory<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &memory,
+            circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+            assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+                &assignment,
+            column_type<BlueprintFieldType> &internal_storage,
+            component_calls &statistics,
+            const common_component_parameters& param) {
+
+            if constexpr (detail::has_poseidon_parameters<BlueprintFieldType>::value) {
+                using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
+                using value_type = typename BlueprintFieldType::value_type;
+                using component_type = components::poseidon<
+                    crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>, BlueprintFieldType>;
+
+                constexpr const std::size_t state_size = component_type::state_size;
+                constexpr const std::size_t rate = state_size - 1;
+
+                const std::size_t length = detail::extract_constant_size_t_value<BlueprintFieldType>(inst->getOperand(1));
+                ASSERT_MSG(length > 0, "poseidon sponge of an empty message");
+                std::vector<var> input = detail::extract_intrinsic_input_vector<BlueprintFieldType, var>(
+                    inst->getOperand(0), length, frame.scalars, memory, bp, assignment, internal_storage, statistics, param);
+
+                const var zero = detail::put_constant<value_type, BlueprintFieldType, var>(value_type::zero(), assignment);
+                std::array<var, state_size> state;
+                state.fill(zero);
+                state[state_size - 1] = detail::put_constant<value_type, BlueprintFieldType, var>(
+                    value_type(length), assignment);
+
+                for (std::size_t offset = 0; offset < length; offset += rate) {
+                    for (std::size_t i = 0; i < rate && offset + i < length; i++) {
+                        if (offset == 0) {
+                            state[i] = input[i];
+                            continue;
+                        }
+                        linear_expression<var> sum;
+                        sum.terms = {{state[i], false}, {input[offset + i], false}};
+                        state[i] = detail::materialize_linear_expression<BlueprintFieldType>(
+                            sum, bp, assignment, internal_storage, statistics, param);
+                    }
+
+                    typename component_type::input_type instance_input = {state};
+                    state = get_component_result<BlueprintFieldType, component_type>
+                        (bp, assignment, internal_storage, statistics, param, instance_input).output_state;
+                }
+
+                handle_result<BlueprintFieldType>(assignment, inst, frame, {state[0]}, param.gen_mode);
+            } else {
+                UNREACHABLE("poseidon parameters are not defined for this native field");
+            }
+        }
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_HASHES_POSEIDON_HPP_
@@ -37,6 +37,11 @@
 #include <nil/crypto3/algebra/curves/vesta.hpp>
 
 #include <nil/blueprint/handle_component.hpp>
+#include <nil/blueprint/extract_constructor_parameters.hpp>
+#include <nil/blueprint/memory.hpp>
+
+#include <array>
+#include <cstdint>
 
 namespace nil {
     namespace blueprint {
@@ -70,6 +75,124 @@ namespace nil {
             handle_component<BlueprintFieldType, component_type>
                     (bp, assignment, internal_storage, statistics, param, instance_input, inst, frame);
         }
+
+        namespace detail {
+
+            constexpr static const std::array<std::uint32_t, 8> sha2_256_initial_state = {
+                0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+            template<typename BlueprintFieldType>
+            crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type> handle_radix_composition(
+                const std::vector<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &digits,
+                std::size_t digit_bits,
+                circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+                assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+                    &assignment,
+                column_type<BlueprintFieldType> &internal_storage,
+                component_calls &statistics,
+                const common_component_parameters& param) {
+
+                using component_type = components::radix_composition<
+                    crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>, BlueprintFieldType>;
+
+                typename component_type::input_type instance_input = {digits};
+
+                return get_component_result<BlueprintFieldType, component_type>
+                    (bp, assignment, internal_storage, statistics, param, instance_input, digits.size(), digit_bits).output;
+            }
+        }    // namespace detail
+
+        // Hashes `length` bytes starting at a pointer. Padding is known on the host, so padding-only words
+        // become constants and the compressions are chained directly on sha256_process states,
+        // which keeps the cost linear in the number of 64-byte blocks.
+        // The layout is not one contiguous component: every block is a separate sha256_process placed
+        // at the end of the table, its input state is copy-constrained to the output state of the previous one.
+        template<typename BlueprintFieldType>
+        void handle_sha2_256_stream_component(
+            const llvm::Instruction *inst,
+            stack_frame<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &frame,
+            program_memory<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &memory,
+            circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+            assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+                &assignment,
+            column_type<BlueprintFieldType> &internal_storage,
+            component_calls &statistics,
+            const common_component_parameters& param) {
+
+            using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
+            using value_type = typename BlueprintFieldType::value_type;
+            using integral_type = typename BlueprintFieldType::integral_type;
+            using component_type = components::sha256_process<
+                crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>;
+
+            constexpr const std::size_t block_bytes = 64;
+            constexpr const std::size_t word_bytes = 4;
+
+            llvm::Value *input_value = inst->getOperand(0);
+            const std::size_t length = detail::extract_constant_size_t_value<BlueprintFieldType>(inst->getOperand(1));
+
+            ptr_type input_ptr = static_cast<ptr_type>(
+                integral_type(detail::var_value<BlueprintFieldType, var>(frame.scalars[input_value], assignment,
+                    internal_storage, param.gen_mode.has_assignments()).data));
+
+            // Message bytes are vars, padding bytes are host constants.
+            // Bytes are range-checked by the radix composition which packs them into words.
+            std::vector<var> message(length);
+            for (std::size_t i = 0; i < length; i++) {
+                ASSERT(memory[input_ptr].size == 1);
+                message[i] = memory.load(input_ptr++);
+                ASSERT(detail::is_initialized<var>(message[i]));
+            }
+            const std::size_t padded_length = (length + 1 + 8 + block_bytes - 1) / block_bytes * block_bytes;
+            std::vector<std::uint8_t> padding(padded_length - length, 0);
+            padding[0] = 0x80;
+            const std::uint64_t bit_length = static_cast<std::uint64_t>(length) * 8;
+            for (std::size_t i = 0; i < 8; i++) {
+                padding[padding.size() - 1 - i] = static_cast<std::uint8_t>(bit_length >> (8 * i));
+            }
+
+            std::vector<var> words;
+            words.reserve(padded_length / word_bytes);
+            for (std::size_t offset = 0; offset < padded_length; offset += word_bytes) {
+                if (offset >= length) {
+                    std::uint32_t word = 0;
+                    for (std::size_t i = 0; i < word_bytes; i++) {
+                        word = (word << 8) | padding[offset + i - length];
+                    }
+                    words.push_back(detail::put_constant<value_type, BlueprintFieldType, var>(value_type(word), assignment));
+                    continue;
+                }
+                std::vector<var> bytes;
+                for (std::size_t i = offset; i < offset + word_bytes; i++) {
+                    bytes.push_back(i < length ? message[i] :
+                        detail::put_constant<value_type, BlueprintFieldType, var>(value_type(padding[i - length]), assignment));
+                }
+                words.push_back(detail::handle_radix_composition<BlueprintFieldType>
+                    (bytes, 8, bp, assignment, internal_storage, statistics, param));
+            }
+
+            std::array<var, 8> state;
+            for (std::size_t i = 0; i < state.size(); i++) {
+                state[i] = detail::put_constant<value_type, BlueprintFieldType, var>(
+                    value_type(detail::sha2_256_initial_state[i]), assignment);
+            }
+            for (std::size_t block = 0; block < padded_length / block_bytes; block++) {
+                typename component_type::input_type instance_input;
+                instance_input.input_state = state;
+                std::copy(words.begin() + block * 16, words.begin() + (block + 1) * 16,
+                          instance_input.input_words.begin());
+                state = get_component_result<BlueprintFieldType, component_type>
+                    (bp, assignment, internal_storage, statistics, param, instance_input).output_state;
+            }
+
+            // Digest is returned in the same shape as assigner_sha2_256: two 128-bit halves
+            std::vector<var> result = {
+                detail::handle_radix_composition<BlueprintFieldType>(std::vector<var>(state.begin(), state.begin() + 4),
+                    32, bp, assignment, internal_storage, statistics, param),
+                detail::handle_radix_composition<BlueprintFieldType>(std::vector<var>(state.begin() + 4, state.end()),
+                    32, bp, assignment, internal_storage, statistics, param)};
+            handle_result<BlueprintFieldType>(assignment, inst, frame, result, param.gen_mode);
+        }
     }    // namespace blueprint
 }    // namespace nil
 
@@ -30,14 +30,19 @@
 #include "llvm/IR/Function.h"
 #include "llvm/IR/Type.h"
 
+#include <nil/blueprint/binary_input.hpp>
+#include <nil/blueprint/json_input_source.hpp>
 #include <nil/blueprint/layout_resolver.hpp>
 #include <nil/blueprint/memory.hpp>
 #include <nil/blueprint/signature_parser.hpp>
 #include <nil/blueprint/stack.hpp>
 #include <nil/blueprint/non_native_marshalling.hpp>
 
+#include <atomic>
+#include <functional>
 #include <iostream>
 #include <fstream>
+#include <thread>
 #include <boost/json/src.hpp>
 
 #include <nil/blueprint/logger.hpp>
@@ -68,6 +73,8 @@ namespace nil {
 
             void reset() {
                 parsed_public_input.clear();
+                argument_layout.clear();
+                int_elements.clear();
                 public_input_idx = 0;
                 private_input_idx = 0;
                 error.str("");
@@ -77,6 +84,11 @@ namespace nil {
 
             constexpr static bool public_input_only = std::is_same_v<Assignment, std::nullptr_t>;
 
+            /// @brief Arrays of fields or ints with at least this many elements are decoded on several threads.
+            constexpr static std::size_t parallel_decode_threshold = 1024;
+            /// @brief Least amount of elements decoded by one thread.
+            constexpr static std::size_t parallel_decode_chunk = 256;
+
             template<typename InputType>
             var put_into_assignment(InputType &input, bool is_private) {
                 if constexpr (public_input_only) {
@@ -84,6 +96,9 @@ namespace nil {
                     parsed_public_input.push_back(input);
                     return var();
                 } else {
+                    if (internal_inputs) {
+                        return detail::put_internal_value<InputType, BlueprintFieldType, var>(input, internal_storage);
+                    }
                     if (is_private) {
                         assignmnt.private_storage(private_input_idx) = input;
                         return var(Assignment::private_storage_index, private_input_idx++, false, var::column_type::public_input);
@@ -234,26 +249,27 @@ namespace nil {
                 }
             }
 
+            static json_elem field_kind_elem(llvm::GaloisFieldKind kind) {
+                switch (kind) {
+                    case llvm::GALOIS_FIELD_PALLAS_BASE:
+                        return json_elem::PALLAS_BASE;
+                    case llvm::GALOIS_FIELD_CURVE25519_BASE:
+                        return json_elem::ED25519_BASE;
+                    case llvm::GALOIS_FIELD_BLS12381_BASE:
+                        return json_elem::BLS12381_BASE;
+                    default:
+                        UNREACHABLE("Error in parsing");
+                }
+            }
+
             bool check_field(const signature_node &node, llvm::GaloisFieldKind kind) {
                 if (node.elem != json_elem::FIELD) {
                     error << "Expected field argument in the input, got \"" << node.elem << "\"";
                     return false;
                 }
                 if (node.children.size() == 1) {
-                    auto corresponding_elem = [](llvm::GaloisFieldKind kind) {
-                        switch (kind) {
-                            case llvm::GALOIS_FIELD_PALLAS_BASE:
-                                return json_elem::PALLAS_BASE;
-                            case llvm::GALOIS_FIELD_CURVE25519_BASE:
-                                return json_elem::ED25519_BASE;
-                            case llvm::GALOIS_FIELD_BLS12381_BASE:
-                                return json_elem::BLS12381_BASE;
-                            default:
-                                UNREACHABLE("Error in parsing");
-                        }
-                    };
                     json_elem child_elem = node.children[0].elem;
-                    json_elem expected_elem = corresponding_elem(kind);
+                    json_elem expected_elem = field_kind_elem(kind);
                     if (child_elem != expected_elem) {
                         error << "Wrong kind of field \"" << child_elem << "\", expected \"" << expected_elem << "\"";
                         return false;
@@ -304,6 +320,7 @@ namespace nil {
                                          bool is_private) {
                 std::vector<var> res = std::vector<var>(1);
                 if (!has_values) {
+                    int_elements.push_back({is_private, is_private ? private_input_idx : public_input_idx, bitness});
                     typename BlueprintFieldType::value_type zero_val = 0;
                     res[0] = put_into_assignment(zero_val, is_private);
                     return res;
@@ -476,6 +493,14 @@ namespace nil {
                           << "\"";
                     return ptr_type(0);
                 }
+                if (node.children.size() == 1 && arr.size() >= parallel_decode_threshold) {
+                    ptr_type end = process_array_in_parallel(array_type->getElementType(), arr, node.children[0], ptr,
+                                                             is_private);
+                    if (end != ptr_type(0)) {
+                        return end;
+                    }
+                    // Not a plain field/int array or a malformed element, the sequential path reports errors
+                }
                 for (size_t i = 0; i < array_type->getNumElements(); ++i) {
                     if (node.children.size() == 1) {
                         ptr = dispatch_type(array_type->getElementType(), arr[i], node.children[0], ptr, is_private);
@@ -485,12 +510,12 @@ namespace nil {
                             return ptr_type(0);
                         }
                         std::string signature(arr[i].as_object().begin()->key());
-                        signature_parser sp;
-                        if (!sp.parse(signature)) {
-                            error << sp.get_error();
+                        const signature_node *elem_node = signatures.parse(signature);
+                        if (elem_node == nullptr) {
+                            error << signatures.get_error();
                             return ptr_type(0);
                         }
-                        ptr = dispatch_type(array_type->getElementType(), arr[i].as_object().at(signature), sp.get_tree(),
+                        ptr = dispatch_type(array_type->getElementType(), arr[i].as_object().at(signature), *elem_node,
                                             ptr, is_private);
                     }
 
@@ -502,6 +527,138 @@ namespace nil {
                 return ptr;
             }
 
+            static bool parse_integral(const boost::json::value &value,
+                                       typename BlueprintFieldType::extended_integral_type &number) {
+                switch (value.kind()) {
+                case boost::json::kind::int64:
+                    number = typename BlueprintFieldType::extended_integral_type(value.as_int64());
+                    return true;
+                case boost::json::kind::uint64:
+                    number = typename BlueprintFieldType::extended_integral_type(value.as_uint64());
+                    return true;
+                case boost::json::kind::string: {
+                    const std::size_t buflen = 256;
+                    char buf[buflen];
+                    std::size_t numlen = value.as_string().size();
+                    if (numlen > buflen - 1) {
+                        return false;
+                    }
+                    value.as_string().copy(buf, numlen);
+                    buf[numlen] = '\0';
+                    number = typename BlueprintFieldType::extended_integral_type(buf);
+                    return true;
+                }
+                default:
+                    return false;
+                }
+            }
+
+            /// @brief Error-free counterpart of `process_field`, writes `field_kind_size` chopped cells into `out`.
+            static bool decode_field(const boost::json::value &value, llvm::GaloisFieldKind kind,
+                                     typename BlueprintFieldType::value_type *out) {
+                typename BlueprintFieldType::extended_integral_type number;
+                if (!parse_integral(value, number)) {
+                    return false;
+                }
+                column_type<BlueprintFieldType> chunks = extended_integral_into_vector<BlueprintFieldType>(kind, number);
+                std::copy(chunks.begin(), chunks.end(), out);
+                return true;
+            }
+
+            /// @brief Error-free counterpart of `process_int`.
+            static bool decode_int(const boost::json::value &value, std::size_t bitness,
+                                   typename BlueprintFieldType::value_type &out) {
+                switch (value.kind()) {
+                case boost::json::kind::int64:
+                    if (bitness < 64 && value.as_int64() >> bitness > 0) {
+                        return false;
+                    }
+                    out = value.as_int64();
+                    return true;
+                case boost::json::kind::uint64:
+                    if (bitness < 64 && value.as_uint64() >> bitness > 0) {
+                        return false;
+                    }
+                    out = value.as_uint64();
+                    return true;
+                case boost::json::kind::string: {
+                    typename BlueprintFieldType::extended_integral_type number;
+                    typename BlueprintFieldType::extended_integral_type one = 1;
+                    if (bitness > 128 || !parse_integral(value, number) || number >= (one << bitness)) {
+                        return false;
+                    }
+                    out = number;
+                    return true;
+                }
+                default:
+                    return false;
+                }
+            }
+
+            /**
+             * @brief Decode a large array of fields or ints on several threads.
+             *
+             * Elements are converted into a staging buffer first, then the cells are put into the assignment
+             * and memory in the same order as the sequential path does. Returns `ptr_type(0)` without
+             * touching the assignment, memory or error message if the array cannot be handled this way.
+             */
+            ptr_type process_array_in_parallel(llvm::Type *elem_type, const boost::json::array &arr,
+                                               const signature_node &elem_node, ptr_type ptr, bool is_private) {
+                std::size_t elem_size;
+                std::function<bool(const boost::json::value &, typename BlueprintFieldType::value_type *)> decode;
+                if (elem_type->isFieldTy()) {
+                    llvm::GaloisFieldKind kind = llvm::cast<llvm::GaloisFieldType>(elem_type)->getFieldKind();
+                    if (elem_node.elem != json_elem::FIELD || elem_node.children.size() > 1 ||
+                        (elem_node.children.size() == 1 && elem_node.children[0].elem != field_kind_elem(kind))) {
+                        return ptr_type(0);
+                    }
+                    elem_size = field_kind_size<BlueprintFieldType>(kind);
+                    decode = [kind](const boost::json::value &value, typename BlueprintFieldType::value_type *out) {
+                        return decode_field(value, kind, out);
+                    };
+                } else if (elem_type->isIntegerTy()) {
+                    if (elem_node.elem != json_elem::INT) {
+                        return ptr_type(0);
+                    }
+                    elem_size = 1;
+                    std::size_t bitness = elem_type->getPrimitiveSizeInBits();
+                    decode = [bitness](const boost::json::value &value, typename BlueprintFieldType::value_type *out) {
+                        return decode_int(value, bitness, *out);
+                    };
+                } else {
+                    return ptr_type(0);
+                }
+
+                std::vector<typename BlueprintFieldType::value_type> staged(arr.size() * elem_size);
+                std::atomic<bool> failed(false);
+                auto decode_range = [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end && !failed.load(std::memory_order_relaxed); i++) {
+                        if (!decode(arr[i], &staged[i * elem_size])) {
+                            failed.store(true, std::memory_order_relaxed);
+                        }
+                    }
+                };
+                const std::size_t jobs = std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                                                               arr.size() / parallel_decode_chunk);
+                const std::size_t chunk = (arr.size() + jobs - 1) / jobs;
+                std::vector<std::thread> workers;
+                for (std::size_t begin = chunk; begin < arr.size(); begin += chunk) {
+                    workers.emplace_back(decode_range, begin, std::min(begin + chunk, arr.size()));
+                }
+                decode_range(0, std::min(chunk, arr.size()));
+                for (auto &worker : workers) {
+                    worker.join();
+                }
+                if (failed) {
+                    return ptr_type(0);
+                }
+
+                for (auto &cell : staged) {
+                    memory.store(ptr++, put_into_assignment(cell, is_private));
+                }
+                return ptr;
+            }
+
             bool check_struct(const signature_node &node, llvm::StructType *struct_type) {
                 if (node.elem != json_elem::STRUCT) {
                     error << "Expected struct argument in the input, got \"" << node.elem << "\"";
@@ -555,12 +712,12 @@ namespace nil {
                             return ptr_type(0);
                         }
                         std::string signature(arr[i].as_object().begin()->key());
-                        signature_parser sp;
-                        if (!sp.parse(signature)) {
-                            error << sp.get_error();
+                        const signature_node *elem_node = signatures.parse(signature);
+                        if (elem_node == nullptr) {
+                            error << signatures.get_error();
                             return ptr_type(0);
                         }
-                        ptr = dispatch_type(elem_ty, arr[i].as_object().at(signature), sp.get_tree(), ptr, is_private);
+                        ptr = dispatch_type(elem_ty, arr[i].as_object().at(signature), *elem_node, ptr, is_private);
                     }
                     if (ptr == ptr_type(0)) {
                         return ptr_type(0);
@@ -607,13 +764,13 @@ namespace nil {
                             return {};
                         }
                         std::string signature(vec[i].as_object().begin()->key());
-                        signature_parser sp;
-                        if (!sp.parse(signature)) {
-                            error << sp.get_error();
+                        const signature_node *elem_node = signatures.parse(signature);
+                        if (elem_node == nullptr) {
+                            error << signatures.get_error();
                             return {};
                         }
                         elem_vector = process_leaf_type(vector_type->getElementType(), vec[i].as_object().at(signature),
-                                                        sp.get_tree(), is_private);
+                                                        *elem_node, is_private);
                     }
                     if (elem_vector.empty()) {
                         return {};
@@ -688,6 +845,20 @@ namespace nil {
                 const boost::json::array &public_input,
                 const boost::json::array &private_input,
                 logger &log
+            ) {
+                json_array_source public_source(public_input);
+                json_array_source private_source(private_input);
+                return fill_arguments(function, public_source, private_source, log);
+            }
+
+            /// @brief Fill arguments taking them from sources one by one, see json_input_source.hpp.
+            /// An argument is the unit of parsing, elements of an array argument are not streamed.
+            template<typename PublicSource, typename PrivateSource>
+            bool fill_arguments(
+                const llvm::Function &function,
+                PublicSource &public_input,
+                PrivateSource &private_input,
+                logger &log
             ) {
                 size_t ret_gap = 0;
 
@@ -708,15 +879,23 @@ namespace nil {
                     }
 
                     bool is_private = current_arg->hasAttribute(llvm::Attribute::PrivateInput);
+                    // Amount is turned from the first cell of the argument into its size after the loop
+                    argument_layout.push_back({is_private, taken_cells()});
 
+                    const boost::json::value *input_elem_ptr = nullptr;
                     if (has_values) {
                         if (is_private) {
                             if (public_input_only) {
                                 increment_iter(is_private);
                                 continue;
                             }
-                            if (private_input.size() <= priv_iter || !private_input[priv_iter].is_object()) {
-                                if (private_input.size() == 0) {
+                            input_elem_ptr = private_input.next();
+                            if (input_elem_ptr == nullptr || !input_elem_ptr->is_object()) {
+                                if (!private_input.get_error().empty()) {
+                                    error << private_input.get_error();
+                                    return false;
+                                }
+                                if (private_input.taken() == 0) {
                                     error << "got argument with [[private_input]] attribute, but private input file was not provided or is empty (use -p flag to provide file name).";
                                     return false;
                                 }
@@ -725,8 +904,13 @@ namespace nil {
                             }
                         }
                         else {
-                            if (public_input.size() <= pub_iter || !public_input[pub_iter].is_object()) {
-                                if (public_input.size() == 0) {
+                            input_elem_ptr = public_input.next();
+                            if (input_elem_ptr == nullptr || !input_elem_ptr->is_object()) {
+                                if (!public_input.get_error().empty()) {
+                                    error << public_input.get_error();
+                                    return false;
+                                }
+                                if (public_input.taken() == 0) {
                                     error << "got argument without [[private_input]], but public input file was not provided or is empty (use -i flag to provide file name).";
                                     return false;
                                 }
@@ -738,10 +922,7 @@ namespace nil {
 
                     boost::json::value empty_value;
                     boost::json::object empty_object;
-                    const boost::json::value &input_elem =
-                        has_values ?
-                            (is_private ? private_input[priv_iter].as_object() : public_input[pub_iter].as_object()) :
-                            empty_value;
+                    const boost::json::value &input_elem = has_values ? *input_elem_ptr : empty_value;
 
                     if (has_values && !input_elem.is_object()) {
                         error << "Expected JSON object as a part of an input array, got \"" << input_elem << "\"";
@@ -749,15 +930,17 @@ namespace nil {
                     }
                     const boost::json::object &arg_obj = has_values ? input_elem.as_object() : empty_object;
                     std::string signature;
-                    signature_parser sp;
+                    static const signature_node empty_node;
+                    const signature_node *arg_node = &empty_node;
                     if (has_values) {
                         if (arg_obj.size() != 1) {
                             error << "Input object size must be 1, got \"" << arg_obj << "\"";
                             return false;
                         }
                         signature = std::string(arg_obj.begin()->key());
-                        if (!sp.parse(signature)) {
-                            error << sp.get_error();
+                        arg_node = signatures.parse(signature);
+                        if (arg_node == nullptr) {
+                            error << signatures.get_error();
                             return false;
                         }
                     }
@@ -769,35 +952,35 @@ namespace nil {
                             auto pointee = current_arg->getAttribute(llvm::Attribute::ByVal).getValueAsType();
                             if (pointee->isStructTy()) {
                                 if (!try_struct(current_arg, llvm::cast<llvm::StructType>(pointee), current_value,
-                                                sp.get_tree(), is_private)) {
+                                                *arg_node, is_private)) {
                                     return false;
                                 }
                                 continue;
                             }
                             if (pointee->isArrayTy()) {
                                 if (!try_array(current_arg, llvm::cast<llvm::ArrayType>(pointee), current_value,
-                                               sp.get_tree(), is_private)) {
+                                               *arg_node, is_private)) {
                                     return false;
                                 }
                                 continue;
                             }
                             UNREACHABLE("Unsupported pointer type");
                         }
-                        if (!try_string(current_arg, arg_type, current_value, sp.get_tree(), is_private)) {
+                        if (!try_string(current_arg, arg_type, current_value, *arg_node, is_private)) {
                             error << "Unhandled pointer argument";
                             return false;
                         }
                     } else if (llvm::isa<llvm::FixedVectorType>(arg_type)) {
-                        if (!take_vector(current_arg, arg_type, current_value, sp.get_tree(), is_private))
+                        if (!take_vector(current_arg, arg_type, current_value, *arg_node, is_private))
                             return false;
                     } else if (llvm::isa<llvm::EllipticCurveType>(arg_type)) {
-                        if (!take_curve(current_arg, arg_type, current_value, sp.get_tree(), is_private))
+                        if (!take_curve(current_arg, arg_type, current_value, *arg_node, is_private))
                             return false;
                     } else if (llvm::isa<llvm::GaloisFieldType>(arg_type)) {
-                        if (!take_field(current_arg, arg_type, current_value, sp.get_tree(), is_private))
+                        if (!take_field(current_arg, arg_type, current_value, *arg_node, is_private))
                             return false;
                     } else if (llvm::isa<llvm::IntegerType>(arg_type)) {
-                        if (!take_int(current_arg, current_value, sp.get_tree(), is_private))
+                        if (!take_int(current_arg, current_value, *arg_node, is_private))
                             return false;
                     }
                     else {
@@ -805,11 +988,28 @@ namespace nil {
                     }
                 }
 
+                std::size_t end = taken_cells();
+                for (auto it = argument_layout.rbegin(); it != argument_layout.rend(); ++it) {
+                    std::size_t begin = it->elements_amount;
+                    it->elements_amount = end - begin;
+                    end = begin;
+                }
+
                 // Check if there are remaining elements of input
-                size_t private_input_size = public_input_only ? priv_iter : private_input.size();
-                if (has_values && (function.arg_size() - ret_gap != public_input.size() + private_input_size)) {
-                    log.debug(boost::format("public_input size: %1%") % public_input.size());
-                    log.debug(boost::format("private_input size: %1%") % private_input_size);
+                const bool has_remaining = has_values &&
+                    (public_input.has_more() || (!public_input_only && private_input.has_more()));
+                // A stream may end before its closing bracket, this is found only when looking for more elements
+                if (!public_input.get_error().empty()) {
+                    error << public_input.get_error();
+                    return false;
+                }
+                if (!public_input_only && !private_input.get_error().empty()) {
+                    error << private_input.get_error();
+                    return false;
+                }
+                if (has_remaining) {
+                    log.debug(boost::format("public_input taken: %1%") % public_input.taken());
+                    log.debug(boost::format("private_input taken: %1%") % private_input.taken());
                     log.debug(boost::format("ret_gap: %1%") % ret_gap);
                     log.debug(boost::format("function.arg_size(): %1%") % function.arg_size());
 
@@ -824,7 +1024,26 @@ namespace nil {
                 return error.str();
             }
 
+            /// @brief Keep input values in internal storage instead of the public input column and private storage.
+            void set_internal_inputs(bool enabled) {
+                internal_inputs = enabled;
+            }
+
+            /// @brief Amount of public input and private storage cells taken by each argument of the last fill.
+            const std::vector<binary_input::argument> &get_argument_layout() const {
+                return argument_layout;
+            }
+
+            /// @brief Cells of integer arguments taken by the last fill without values.
+            const std::vector<binary_input::int_element> &get_int_elements() const {
+                return int_elements;
+            }
+
         private:
+            std::size_t taken_cells() const {
+                return public_input_only ? parsed_public_input.size() : public_input_idx + private_input_idx;
+            }
+
             stack_frame<var> &frame;
             program_memory<var> &memory;
             Assignment &assignmnt;
@@ -833,10 +1052,14 @@ namespace nil {
             column_type<BlueprintFieldType> &internal_storage;
             size_t public_input_idx;
             size_t private_input_idx;
+            std::vector<binary_input::argument> argument_layout;
+            std::vector<binary_input::int_element> int_elements;
             std::ostringstream error;
+            signature_cache signatures;
             size_t pub_iter;
             size_t priv_iter;
             bool has_values;
+            bool internal_inputs = false;
         };
     }   // namespace blueprint
 }    // namespace nil
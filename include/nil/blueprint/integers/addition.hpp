@@ -34,6 +34,7 @@
 
 #include <nil/blueprint/basic_non_native_policy.hpp>
 #include <nil/blueprint/fields/addition.hpp>
+#include <nil/blueprint/fields/constant_operand.hpp>
 
 #include <nil/blueprint/asserts.hpp>
 #include <nil/blueprint/stack.hpp>
@@ -57,6 +58,11 @@ namespace nil {
             llvm::Value *operand0 = inst->getOperand(0);
             llvm::Value *operand1 = inst->getOperand(1);
 
+            if (detail::handle_native_field_constant_operand_component<BlueprintFieldType>(
+                    inst, frame, bp, assignment, internal_storage, statistics, param)) {
+                return;
+            }
+
             auto res = detail::handle_native_field_addition_component<BlueprintFieldType>(
                                 operand0, operand1, frame.scalars, bp, assignment, internal_storage, statistics, param);
 
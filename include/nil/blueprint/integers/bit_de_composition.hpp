@@ -33,6 +33,9 @@
 #include <nil/blueprint/non_native_marshalling.hpp>
 #include <nil/blueprint/handle_component.hpp>
 #include <nil/blueprint/extract_constructor_parameters.hpp>
+#include <nil/blueprint/range_facts.hpp>
+
+#include <algorithm>
 
 namespace nil {
     namespace blueprint {
@@ -47,6 +50,7 @@ namespace nil {
             typename std::map<const llvm::Value *, std::vector<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>>> &vectors,
             typename std::map<const llvm::Value *, crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &variables,
             program_memory<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &memory,
+            range_facts<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &ranges,
             circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
             assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
                 &assignment,
@@ -62,10 +66,24 @@ namespace nil {
 
             using component_type = nil::blueprint::components::bit_decomposition<
                 crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>;
-            typename component_type::input_type instance_input({component_input});
-
-            auto result = get_component_result<BlueprintFieldType, component_type>
-                (bp, assignment, internal_storage, statistics, param, instance_input, BitsAmount, Mode).output;
+            std::vector<var> result;
+            // facts are taken in size estimation mode too, so that it places the same components as the real run
+            const std::vector<var> *known_bits = ranges.find_decomposition(component_input, BitsAmount);
+            if (known_bits != nullptr) {
+                result = *known_bits;
+                if (!is_msb) {
+                    std::reverse(result.begin(), result.end());
+                }
+            } else {
+                typename component_type::input_type instance_input({component_input});
+                result = get_component_result<BlueprintFieldType, component_type>
+                    (bp, assignment, internal_storage, statistics, param, instance_input, BitsAmount, Mode).output;
+                std::vector<var> msb_first_bits = result;
+                if (!is_msb) {
+                    std::reverse(msb_first_bits.begin(), msb_first_bits.end());
+                }
+                ranges.add_decomposition(component_input, BitsAmount, msb_first_bits);
+            }
 
                 ptr_type result_ptr = static_cast<ptr_type>(
                     typename BlueprintFieldType::integral_type(detail::var_value<BlueprintFieldType, var>
@@ -118,6 +136,7 @@ namespace nil {
             const llvm::Instruction *inst,
             stack_frame<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &frame,
             program_memory<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &memory,
+            range_facts<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &ranges,
             circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
             assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
                 &assignment,
@@ -139,7 +158,7 @@ namespace nil {
 
             detail::handle_native_field_decomposition_component<BlueprintFieldType>(
                                 bitness_from_intrinsic, result_value, input, is_msb, frame.vectors,
-                                frame.scalars, memory, bp, assignment, internal_storage, statistics, param);
+                                frame.scalars, memory, ranges, bp, assignment, internal_storage, statistics, param);
         }
 
         template<typename BlueprintFieldType>
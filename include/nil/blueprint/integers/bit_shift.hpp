@@ -32,7 +32,6 @@
 
 #include <nil/blueprint/handle_component.hpp>
 
-
 namespace nil {
     namespace blueprint {
         namespace detail {
@@ -71,6 +70,62 @@ namespace nil {
             return get_component_result<BlueprintFieldType, component_type>
                 (bp, assignment, internal_storage, statistics, param, instance_input, Bitness, Shift, left_or_right);
             }
+
+        /**
+         * @brief Shift by an amount known only at proving time.
+         *
+         * x << s is (x * 2^s) mod 2^bitness and x >> s is x / 2^s, where 2^s is computed
+         * by `power_of_two` from the bits of s.
+         */
+        template<typename BlueprintFieldType>
+        crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>
+            handle_native_field_bit_shift_variable_component(
+            std::size_t Bitness,
+            llvm::Value *operand0, llvm::Value *operand1,
+            typename std::map<const llvm::Value *, crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &variables,
+            circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+            assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+                &assignment,
+            column_type<BlueprintFieldType> &internal_storage,
+            component_calls &statistics,
+            const common_component_parameters& param,
+            typename nil::blueprint::components::bit_shift_mode left_or_right) {
+
+            using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
+            using value_type = typename BlueprintFieldType::value_type;
+            using integral_type = typename BlueprintFieldType::integral_type;
+
+            using power_component_type = components::plonk_power_of_two<BlueprintFieldType>;
+            using mul_component_type = components::multiplication<
+                crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>,
+                BlueprintFieldType, basic_non_native_policy<BlueprintFieldType>>;
+            using div_rem_component_type = components::division_remainder<
+                crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>;
+
+            var x = variables[operand0];
+            var shift_var = variables[operand1];
+
+            typename power_component_type::input_type power_input({shift_var});
+            var power = get_component_result<BlueprintFieldType, power_component_type>
+                (bp, assignment, internal_storage, statistics, param, power_input, Bitness).output;
+
+            if (left_or_right == nil::blueprint::components::bit_shift_mode::RIGHT) {
+                typename div_rem_component_type::input_type div_input({x, power});
+                return get_component_result<BlueprintFieldType, div_rem_component_type>
+                    (bp, assignment, internal_storage, statistics, param, div_input, Bitness, true).quotient;
+            }
+
+            typename mul_component_type::input_type mul_input({x, power});
+            var product = get_component_result<BlueprintFieldType, mul_component_type>
+                (bp, assignment, internal_storage, statistics, param, mul_input).output;
+
+            // x * 2^s < 2^(2 * Bitness), bits shifted out of Bitness are the quotient
+            var modulus = put_constant<value_type, BlueprintFieldType, var>(
+                value_type(integral_type(1) << Bitness), assignment);
+            typename div_rem_component_type::input_type mod_input({product, modulus});
+            return get_component_result<BlueprintFieldType, div_rem_component_type>
+                (bp, assignment, internal_storage, statistics, param, mod_input, 2 * Bitness, true).remainder;
+        }
         }    // namespace detail
 
         template<typename BlueprintFieldType>
@@ -100,6 +155,38 @@ namespace nil {
             handle_component_result<BlueprintFieldType, component_type>(assignment, inst, frame, res, param.gen_mode);
         }
 
+        template<typename BlueprintFieldType>
+        void handle_integer_bit_shift_component(
+            const llvm::Instruction *inst,
+            stack_frame<crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>> &frame,
+            circuit_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+            assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+                &assignment,
+            column_type<BlueprintFieldType> &internal_storage,
+            component_calls &statistics,
+            const common_component_parameters& param,
+            typename nil::blueprint::components::bit_shift_mode left_or_right) {
+
+            using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
+
+            const var &shift_var = frame.scalars[inst->getOperand(1)];
+            if (shift_var.type == var::column_type::constant && !detail::is_internal<var>(shift_var)) {
+                handle_integer_bit_shift_constant_component<BlueprintFieldType>(
+                    inst, frame, bp, assignment, internal_storage, statistics, param, left_or_right);
+                return;
+            }
+
+            ASSERT(inst->getOperand(0)->getType()->getPrimitiveSizeInBits() == inst->getOperand(1)->getType()->getPrimitiveSizeInBits());
+
+            std::size_t bitness = inst->getOperand(0)->getType()->getPrimitiveSizeInBits();
+            ASSERT_MSG(2 * bitness < BlueprintFieldType::modulus_bits, "shift by variable amount is too wide for the field");
+
+            auto res = detail::handle_native_field_bit_shift_variable_component<BlueprintFieldType>(
+                                bitness, inst->getOperand(0), inst->getOperand(1), frame.scalars, bp, assignment,
+                                internal_storage, statistics, param, left_or_right);
+            handle_result<BlueprintFieldType>(assignment, inst, frame, {res}, param.gen_mode);
+        }
+
     }    // namespace blueprint
 }    // namespace nil
 
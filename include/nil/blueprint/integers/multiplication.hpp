@@ -61,6 +61,11 @@ namespace nil {
             llvm::Value *operand0 = inst->getOperand(0);
             llvm::Value *operand1 = inst->getOperand(1);
 
+            if (detail::handle_native_field_constant_operand_component<BlueprintFieldType>(
+                    inst, frame, bp, assignment, internal_storage, statistics, param)) {
+                return;
+            }
+
             auto res = detail::handle_native_field_multiplication_component<BlueprintFieldType>(
                                     operand0, operand1, frame.scalars, bp, assignment, internal_storage, statistics, param);
             handle_component_result<BlueprintFieldType, component_type>(assignment, inst, frame, res, param.gen_mode);
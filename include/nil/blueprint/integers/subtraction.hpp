@@ -35,6 +35,7 @@
 #include <nil/blueprint/basic_non_native_policy.hpp>
 
 #include <nil/blueprint/fields/subtraction.hpp>
+#include <nil/blueprint/fields/constant_operand.hpp>
 
 #include <nil/blueprint/asserts.hpp>
 #include <nil/blueprint/stack.hpp>
@@ -61,6 +62,11 @@ namespace nil {
             llvm::Value *operand0 = inst->getOperand(0);
             llvm::Value *operand1 = inst->getOperand(1);
 
+            if (detail::handle_native_field_constant_operand_component<BlueprintFieldType>(
+                    inst, frame, bp, assignment, internal_storage, statistics, param)) {
+                return;
+            }
+
             auto res = detail::handle_native_field_subtraction_component<BlueprintFieldType>(
                                               operand0, operand1, frame.scalars, bp, assignment, internal_storage, statistics, param);
             handle_component_result<BlueprintFieldType, component_type>(assignment, inst, frame, res, param.gen_mode);
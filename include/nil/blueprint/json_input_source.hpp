@@ -0,0 +1,187 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_JSON_INPUT_SOURCE_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_JSON_INPUT_SOURCE_HPP_
+
+#include <nil/blueprint/asserts.hpp>
+
+#include <boost/json.hpp>
+
+#include <array>
+#include <cctype>
+#include <istream>
+#include <string>
+
+namespace nil {
+    namespace blueprint {
+
+        /// @brief Arguments of an input file which is already parsed into a JSON array.
+        class json_array_source {
+        public:
+            json_array_source(const boost::json::array &arguments) : arguments(arguments), idx(0) {
+            }
+
+            /// @brief Next argument or `nullptr` if there are no more.
+            const boost::json::value *next() {
+                return idx < arguments.size() ? &arguments[idx++] : nullptr;
+            }
+
+            bool has_more() {
+                return idx < arguments.size();
+            }
+
+            std::size_t taken() const {
+                return idx;
+            }
+
+            const std::string &get_error() const {
+                return error;
+            }
+
+        private:
+            const boost::json::array &arguments;
+            std::size_t idx;
+            std::string error;
+        };
+
+        /**
+         * @brief Arguments of an input file read from a stream one by one.
+         *
+         * The file is a JSON array of arguments, only the argument being dispatched is kept as a JSON value,
+         * so memory is bounded by the largest argument rather than by the whole input. A single argument,
+         * e.g. one huge array, is still parsed into a full JSON value.
+         */
+        class json_stream_source {
+        public:
+            json_stream_source(std::istream &stream) : stream(stream), begin(0), end(0), state(state_type::START), count(0) {
+            }
+
+            /// @brief Next argument or `nullptr` if there are no more or the input is malformed, see `get_error`.
+            const boost::json::value *next() {
+                if (!has_more()) {
+                    return nullptr;
+                }
+                boost::json::stream_parser parser;
+                boost::json::error_code ec;
+                while (!parser.done()) {
+                    if (begin == end && !fill()) {
+                        error = "Unexpected end of input";
+                        state = state_type::FINISHED;
+                        return nullptr;
+                    }
+                    begin += parser.write_some(buffer.data() + begin, end - begin, ec);
+                    if (ec) {
+                        error = "Failed to parse input: " + ec.message();
+                        state = state_type::FINISHED;
+                        return nullptr;
+                    }
+                }
+                current = parser.release();
+                state = state_type::AFTER_ARGUMENT;
+                count++;
+                return &current;
+            }
+
+            /// @brief Skips separators, `true` if an argument follows.
+            bool has_more() {
+                while (state != state_type::FINISHED) {
+                    int c = peek();
+                    if (c == EOF) {
+                        if (state != state_type::START) {
+                            error = "Unexpected end of input";
+                        }
+                        state = state_type::FINISHED;
+                    } else if (std::isspace(c)) {
+                        begin++;
+                    } else if (state == state_type::START) {
+                        if (c != '[') {
+                            error = "Input must be a JSON array";
+                            state = state_type::FINISHED;
+                        } else {
+                            begin++;
+                            state = state_type::BEFORE_ARGUMENT;
+                        }
+                    } else if (c == ']') {
+                        begin++;
+                        state = state_type::FINISHED;
+                    } else if (state == state_type::AFTER_ARGUMENT) {
+                        if (c != ',') {
+                            error = "Expected ',' between input arguments";
+                            state = state_type::FINISHED;
+                        } else {
+                            begin++;
+                            state = state_type::BEFORE_ARGUMENT;
+                        }
+                    } else {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            std::size_t taken() const {
+                return count;
+            }
+
+            const std::string &get_error() const {
+                return error;
+            }
+
+        private:
+            enum class state_type {
+                START,
+                BEFORE_ARGUMENT,
+                AFTER_ARGUMENT,
+                FINISHED,
+            };
+
+            bool fill() {
+                stream.read(buffer.data(), buffer.size());
+                begin = 0;
+                end = stream.gcount();
+                return end != 0;
+            }
+
+            int peek() {
+                if (begin == end && !fill()) {
+                    return EOF;
+                }
+                return static_cast<unsigned char>(buffer[begin]);
+            }
+
+            std::istream &stream;
+            std::array<char, 1 << 16> buffer;
+            std::size_t begin;
+            std::size_t end;
+            state_type state;
+            std::size_t count;
+            boost::json::value current;
+            std::string error;
+        };
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_JSON_INPUT_SOURCE_HPP_
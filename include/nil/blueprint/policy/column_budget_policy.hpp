@@ -0,0 +1,77 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2023 Alexey Kokoshnikov <alexeikokoshnikov@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_POLICY_COLUMN_BUDGET_POLICY_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_POLICY_COLUMN_BUDGET_POLICY_HPP_
+
+#include <algorithm>
+#include <string>
+
+#include <nil/blueprint/policy/policy.hpp>
+
+namespace nil {
+    namespace blueprint {
+        namespace detail {
+            /**
+             * @brief Never uses more than `budget` witness columns.
+             *
+             * Among variants fitting into the budget chooses the one with the least rows, then the least gates.
+             * A component which does not fit is placed with its narrowest variant and reported by `get_error`.
+             */
+            struct ColumnBudgetPolicy: public Policy {
+                ColumnBudgetPolicy(std::uint32_t budget) : budget(budget) {
+                }
+
+                FlexibleParameters get_parameters(const std::vector<WitnessVariant>& witness_variants) override {
+                    const WitnessVariant *best = nullptr;
+                    for (const auto &v : witness_variants) {
+                        if (v.witness_amount > budget) {
+                            continue;
+                        }
+                        if (best == nullptr || v.rows_amount < best->rows_amount ||
+                            (v.rows_amount == best->rows_amount && v.gates_amount < best->gates_amount)) {
+                            best = &v;
+                        }
+                    }
+                    if (best == nullptr) {
+                        best = &*std::min_element(witness_variants.begin(), witness_variants.end(),
+                                                  [](const WitnessVariant &a, const WitnessVariant &b) {
+                                                      return a.witness_amount < b.witness_amount;});
+                        if (error.empty()) {
+                            error = "component needs at least " + std::to_string(best->witness_amount) +
+                                    " witness columns, the budget is " + std::to_string(budget);
+                        }
+                    }
+                    return FlexibleParameters(best->witness_amount);
+                }
+
+            private:
+                std::uint32_t budget;
+            };
+        }    // namespace detail
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_POLICY_COLUMN_BUDGET_POLICY_HPP_
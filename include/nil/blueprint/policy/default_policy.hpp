@@ -33,12 +33,12 @@ namespace nil {
     namespace blueprint {
         namespace detail {
             struct DefaultPolicy: public Policy {
-                FlexibleParameters get_parameters(const std::vector<std::pair<std::uint32_t, std::uint32_t>>& witness_variants) const override {
+                FlexibleParameters get_parameters(const std::vector<WitnessVariant>& witness_variants) override {
                     const auto witness_amount = *std::min_element(witness_variants.begin(), witness_variants.end(),
-                                                                  [](const std::pair<std::uint32_t, std::uint32_t>& a,
-                                                                           const std::pair<std::uint32_t, std::uint32_t>& b) {
-                                                                                return a.second < b.second;});
-                    return FlexibleParameters(witness_amount.first);
+                                                                  [](const WitnessVariant& a,
+                                                                           const WitnessVariant& b) {
+                                                                                return a.isolated_cost() < b.isolated_cost();});
+                    return FlexibleParameters(witness_amount.witness_amount);
                 }
             };
         }    // namespace detail
@@ -0,0 +1,59 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2023 Alexey Kokoshnikov <alexeikokoshnikov@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_POLICY_MIN_ROWS_POLICY_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_POLICY_MIN_ROWS_POLICY_HPP_
+
+#include <algorithm>
+#include <tuple>
+
+#include <nil/blueprint/policy/policy.hpp>
+
+namespace nil {
+    namespace blueprint {
+        namespace detail {
+            /**
+             * @brief Chooses the variant with the fewest rows, then the fewest gates.
+             *
+             * The choice is greedy, one component at a time, so it gives the least sum of component rows.
+             * Padded rows of the whole table are not minimized: a variant with more rows but fewer gates
+             * may fit under the same power of two, which this policy does not look at.
+             */
+            struct MinRowsPolicy: public Policy {
+                FlexibleParameters get_parameters(const std::vector<WitnessVariant>& witness_variants) override {
+                    const auto cost = [](const WitnessVariant& v) {
+                        return std::make_tuple(v.rows_amount, v.gates_amount, v.witness_amount);
+                    };
+                    const auto best = *std::min_element(witness_variants.begin(), witness_variants.end(),
+                                                        [&cost](const WitnessVariant& a, const WitnessVariant& b) {
+                                                            return cost(a) < cost(b);});
+                    return FlexibleParameters(best.witness_amount);
+                }
+            };
+        }    // namespace detail
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_POLICY_MIN_ROWS_POLICY_HPP_
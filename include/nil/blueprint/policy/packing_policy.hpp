@@ -0,0 +1,71 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2023 Alexey Kokoshnikov <alexeikokoshnikov@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_POLICY_PACKING_POLICY_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_POLICY_PACKING_POLICY_HPP_
+
+#include <algorithm>
+#include <tuple>
+
+#include <nil/blueprint/policy/policy.hpp>
+#include <nil/blueprint/policy/row_packer.hpp>
+
+namespace nil {
+    namespace blueprint {
+        namespace detail {
+            /**
+             * @brief Greedy horizontal packing of components within `layout_width` witness columns.
+             *
+             * Packable components are placed side by side by the row packer of the policy. The variant
+             * which fits into the current shelf of the packer is preferred, otherwise the narrowest one,
+             * so there is room left for the following components.
+             */
+            struct PackingPolicy: public Policy {
+                PackingPolicy(std::uint32_t layout_width) : packer(layout_width) {
+                }
+
+                FlexibleParameters get_parameters(const std::vector<WitnessVariant>& witness_variants) override {
+                    const auto cost = [this](const WitnessVariant& v) {
+                        const std::size_t added_rows = packer.fits_shelf(v.witness_amount, v.rows_amount) ? 0 : v.rows_amount;
+                        return std::make_tuple(added_rows, v.witness_amount, v.rows_amount, v.gates_amount);
+                    };
+                    const auto best = *std::min_element(witness_variants.begin(), witness_variants.end(),
+                                                        [&cost](const WitnessVariant& a, const WitnessVariant& b) {
+                                                            return cost(a) < cost(b);});
+                    return FlexibleParameters(best.witness_amount);
+                }
+
+                row_packer *get_packer() override {
+                    return &packer;
+                }
+
+            private:
+                row_packer packer;
+            };
+        }    // namespace detail
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_POLICY_PACKING_POLICY_HPP_
@@ -26,15 +26,72 @@
 #define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_POLICY_POLICY_HPP_
 
 #include <algorithm>
+#include <string>
 
 #include <nil/blueprint/utilities.hpp>
+#include <nil/blueprint/policy/row_packer.hpp>
 
 namespace nil {
     namespace blueprint {
         namespace detail {
+            /// @brief Amount of rows of the table, which is padded to a power of two.
+            inline std::size_t padded_rows_amount(std::size_t rows_amount) {
+                std::size_t padded = 1;
+                while (padded < rows_amount) {
+                    padded <<= 1;
+                }
+                return padded;
+            }
+
+            /**
+             * @brief Chooses witness amount for each placed component.
+             *
+             * Policies are asked in the order components are placed,
+             * so a policy may keep track of the table built so far. Each assigner owns its policy
+             * and creates it anew for every evaluation, together with the witness limit of the assigner.
+             */
             struct Policy {
-                virtual FlexibleParameters get_parameters(const std::vector<std::pair<std::uint32_t,
-                        std::uint32_t>>& witness_variants) const = 0;
+                virtual ~Policy() = default;
+
+                /// @brief Components may use at most `amount` witness columns.
+                void set_witness_limit(std::uint32_t amount) {
+                    witness_limit = amount;
+                    restriction_manifest = compiler_manifest(amount, true);
+                }
+
+                std::uint32_t get_witness_limit() const {
+                    return witness_limit;
+                }
+
+                /// @brief Manifest every component is intersected with, see `ManifestReader`.
+                const compiler_manifest &get_restriction_manifest() const {
+                    return restriction_manifest;
+                }
+
+                virtual FlexibleParameters get_parameters(const std::vector<WitnessVariant>& witness_variants) = 0;
+
+                /// @brief Row packer placing narrow components side by side, no packing if null.
+                virtual row_packer *get_packer() {
+                    return nullptr;
+                }
+
+                /**
+                 * @brief Why a placed component breaks the policy, empty if none does.
+                 *
+                 * Such a component is still placed, with a variant chosen by the policy,
+                 * and the evaluation fails once the instruction is handled.
+                 */
+                const std::string &get_error() const {
+                    return error;
+                }
+
+            protected:
+                std::string error;
+
+            private:
+                std::uint32_t witness_limit = CompilerRestrictions::default_witness_amount;
+                compiler_manifest restriction_manifest =
+                    compiler_manifest(CompilerRestrictions::default_witness_amount, true);
             };
         }    // namespace detail
     }    // namespace blueprint
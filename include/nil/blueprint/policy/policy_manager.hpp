@@ -26,47 +26,114 @@
 #define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_POLICY_POLICY_MANAGER_HPP_
 
 #include <algorithm>
+#include <cctype>
+#include <iostream>
 #include <map>
+#include <memory>
+#include <string>
 
 #include <nil/blueprint/policy/default_policy.hpp>
+#include <nil/blueprint/policy/min_rows_policy.hpp>
+#include <nil/blueprint/policy/column_budget_policy.hpp>
+#include <nil/blueprint/policy/packing_policy.hpp>
 
 namespace nil {
     namespace blueprint {
         namespace detail {
 
             enum class policy_kind {
-                DEFAULT
+                DEFAULT,
+                MIN_ROWS,
+                COLUMN_BUDGET,
+                PACKING
             };
 
+            /// @brief Creates witness policies, see `Policy`.
             struct PolicyManager {
-                static FlexibleParameters get_parameters(const std::vector <std::pair<std::uint32_t,
-                        std::uint32_t>> &witness_variants) {
-                    if (!policy) {
-                        policy.reset(new DefaultPolicy());
-                    }
-                    return policy->get_parameters(witness_variants);
-                }
-
-                static void set_policy(policy_kind kind) {
+                /**
+                 * @brief Create witness policy.
+                 *
+                 * @param kind policy kind
+                 * @param witness_limit witness columns available to components
+                 * @param columns_limit witness columns budget of COLUMN_BUDGET policy
+                 */
+                static std::unique_ptr<Policy> make_policy(policy_kind kind, std::uint32_t witness_limit,
+                                                           std::uint32_t columns_limit = 0) {
+                    std::unique_ptr<Policy> policy;
                     switch (kind) {
+                        case policy_kind::MIN_ROWS: {
+                            policy = std::make_unique<MinRowsPolicy>();
+                            break;
+                        }
+                        case policy_kind::COLUMN_BUDGET: {
+                            policy = std::make_unique<ColumnBudgetPolicy>(columns_limit);
+                            break;
+                        }
+                        case policy_kind::PACKING: {
+                            policy = std::make_unique<PackingPolicy>(witness_limit);
+                            break;
+                        }
                         case policy_kind::DEFAULT:
                         default: {
-                            policy.reset(new DefaultPolicy());
+                            policy = std::make_unique<DefaultPolicy>();
+                            break;
                         }
                     }
+                    policy->set_witness_limit(witness_limit);
+                    return policy;
                 }
 
-                static void set_policy(const std::string &kind_str) {
-                    const auto it = policy_kind_map.find(kind_str);
-                    if (it != policy_kind_map.end()) {
-                        set_policy(it->second);
+                /**
+                 * @brief Create witness policy by its name.
+                 *
+                 * Known names are "default", "min_rows", "packing" and "column_budget:<witness amount>",
+                 * empty name means "default". Returns null and reports to std::cerr if the name
+                 * is unknown or the column budget is malformed.
+                 */
+                static std::unique_ptr<Policy> make_policy(
+                        const std::string &kind_str,
+                        std::uint32_t witness_limit = CompilerRestrictions::default_witness_amount) {
+                    if (kind_str.empty()) {
+                        return make_policy(policy_kind::DEFAULT, witness_limit);
                     }
+                    const auto delimiter_pos = kind_str.find(':');
+                    const auto it = policy_kind_map.find(kind_str.substr(0, delimiter_pos));
+                    if (it == policy_kind_map.end()) {
+                        std::cerr << "Unknown witness policy \"" << kind_str << "\"" << std::endl;
+                        return nullptr;
+                    }
+                    if (it->second != policy_kind::COLUMN_BUDGET) {
+                        if (delimiter_pos != std::string::npos) {
+                            std::cerr << "Witness policy \"" << it->first << "\" takes no parameters" << std::endl;
+                            return nullptr;
+                        }
+                        return make_policy(it->second, witness_limit);
+                    }
+                    std::uint32_t columns_limit = 0;
+                    if (delimiter_pos == std::string::npos ||
+                        !parse_columns_limit(kind_str.substr(delimiter_pos + 1), columns_limit)) {
+                        std::cerr << "Wrong column budget in witness policy \"" << kind_str
+                                  << "\", expected \"column_budget:<witness amount>\"" << std::endl;
+                        return nullptr;
+                    }
+                    return make_policy(it->second, witness_limit, columns_limit);
                 }
             private:
-                inline static std::shared_ptr <Policy> policy = nullptr;
+                /// @brief Parse positive decimal amount of witness columns.
+                static bool parse_columns_limit(const std::string &str, std::uint32_t &columns_limit) {
+                    if (str.empty() || str.size() > 9 ||
+                        !std::all_of(str.begin(), str.end(), [](unsigned char c) { return std::isdigit(c); })) {
+                        return false;
+                    }
+                    columns_limit = static_cast<std::uint32_t>(std::stoul(str));
+                    return columns_limit > 0;
+                }
 
                 inline static const std::map<std::string, policy_kind> policy_kind_map = {
-                        {"default", policy_kind::DEFAULT}
+                        {"default", policy_kind::DEFAULT},
+                        {"min_rows", policy_kind::MIN_ROWS},
+                        {"column_budget", policy_kind::COLUMN_BUDGET},
+                        {"packing", policy_kind::PACKING}
                 };
             };
         }    // namespace detail
@@ -0,0 +1,89 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2023 Alexey Kokoshnikov <alexeikokoshnikov@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_POLICY_ROW_PACKER_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_POLICY_ROW_PACKER_HPP_
+
+#include <cstdint>
+#include <cstddef>
+
+namespace nil {
+    namespace blueprint {
+        namespace detail {
+            /**
+             * @brief Places narrow components side by side in the same rows.
+             *
+             * The first packed component opens a shelf at the end of the table, following ones are put
+             * into the shelf with column offsets while they fit into its width and height.
+             * The shelf is closed as soon as any rows are allocated after it or another prover takes the table.
+             */
+            struct row_packer {
+                struct placement {
+                    std::size_t start_row;
+                    std::uint32_t column_offset;
+                };
+
+                row_packer(std::uint32_t layout_width) : layout_width(layout_width) {
+                }
+
+                /// @brief Whether component fits into the rest of the current shelf.
+                bool fits_shelf(std::uint32_t witness_amount, std::size_t rows_amount) const {
+                    return shelf_width + witness_amount <= layout_width && rows_amount <= shelf_height;
+                }
+
+                /**
+                 * @brief Choose rows and columns of a packable component.
+                 *
+                 * @param prover_idx prover the component belongs to
+                 * @param table_rows rows allocated in the table so far
+                 */
+                placement place(std::uint32_t prover_idx, std::size_t table_rows,
+                                std::uint32_t witness_amount, std::size_t rows_amount) {
+                    const bool shelf_is_open = prover_idx == shelf_prover_idx &&
+                                               shelf_start_row + shelf_height == table_rows;
+                    if (shelf_is_open && fits_shelf(witness_amount, rows_amount)) {
+                        placement result = {shelf_start_row, shelf_width};
+                        shelf_width += witness_amount;
+                        return result;
+                    }
+                    shelf_prover_idx = prover_idx;
+                    shelf_start_row = table_rows;
+                    shelf_height = rows_amount;
+                    shelf_width = witness_amount;
+                    return {table_rows, 0};
+                }
+
+            private:
+                std::uint32_t layout_width;
+                std::uint32_t shelf_prover_idx = 0;
+                std::size_t shelf_start_row = 0;
+                std::size_t shelf_height = 0;
+                std::uint32_t shelf_width = 0;
+            };
+        }    // namespace detail
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_POLICY_ROW_PACKER_HPP_
@@ -0,0 +1,114 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_RANGE_FACTS_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_RANGE_FACTS_HPP_
+
+#include <cstdint>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace nil {
+    namespace blueprint {
+
+        /**
+         * @brief Facts about variables which are already proven by the circuit.
+         *
+         * A variable may be known to be less than 2^k because some component range-checked it,
+         * it may be decomposed into bits already, and a comparison of two variables may be done already.
+         * Components which need the same facts again take them from here instead of proving them twice.
+         *
+         * Variables are identified by their cell, so facts are valid while the table is not rebuilt.
+         * Each prover proves facts in its own table on a copy of the cell, so the assigner clears them
+         * when it switches to the next prover.
+         **/
+        template<typename VarType>
+        class range_facts {
+        public:
+            using cell_type = std::tuple<int, std::size_t, std::int64_t>;
+
+            /// @brief Remember that `v` < 2^bits.
+            void set_bound(const VarType &v, std::size_t bits) {
+                auto it = bounds.find(cell(v));
+                if (it == bounds.end()) {
+                    bounds[cell(v)] = bits;
+                } else if (it->second > bits) {
+                    it->second = bits;
+                }
+            }
+
+            /// @brief Check if `v` is known to be less than 2^bits.
+            bool is_bounded(const VarType &v, std::size_t bits) const {
+                auto it = bounds.find(cell(v));
+                return it != bounds.end() && it->second <= bits;
+            }
+
+            /// @brief Bits of `v` in msb first order if it was decomposed into `bits` bits, nullptr otherwise.
+            const std::vector<VarType> *find_decomposition(const VarType &v, std::size_t bits) const {
+                auto it = decompositions.find({cell(v), bits});
+                return it == decompositions.end() ? nullptr : &it->second;
+            }
+
+            /// @brief Remember decomposition of `v`, `msb_first_bits` are bits in msb first order.
+            void add_decomposition(const VarType &v, std::size_t bits, const std::vector<VarType> &msb_first_bits) {
+                decompositions[{cell(v), bits}] = msb_first_bits;
+                set_bound(v, bits);
+                for (const auto &bit : msb_first_bits) {
+                    set_bound(bit, 1);
+                }
+            }
+
+            /// @brief Result of comparison `kind` of `x` and `y` if it was done already, nullptr otherwise.
+            const VarType *find_comparison(const VarType &x, const VarType &y, int kind) const {
+                auto it = comparisons.find({cell(x), cell(y), kind});
+                return it == comparisons.end() ? nullptr : &it->second;
+            }
+
+            void add_comparison(const VarType &x, const VarType &y, int kind, const VarType &flag) {
+                comparisons[{cell(x), cell(y), kind}] = flag;
+                set_bound(flag, 1);
+            }
+
+            void clear() {
+                bounds.clear();
+                decompositions.clear();
+                comparisons.clear();
+            }
+
+        private:
+            static cell_type cell(const VarType &v) {
+                return {static_cast<int>(v.type), std::size_t(v.index), std::int64_t(v.rotation)};
+            }
+
+            std::map<cell_type, std::size_t> bounds;
+            std::map<std::pair<cell_type, std::size_t>, std::vector<VarType>> decompositions;
+            std::map<std::tuple<cell_type, cell_type, int>, VarType> comparisons;
+        };
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_RANGE_FACTS_HPP_
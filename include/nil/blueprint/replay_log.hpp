@@ -0,0 +1,101 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2022 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_REPLAY_LOG_HPP_
+#define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_REPLAY_LOG_HPP_
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+#include <nil/blueprint/blueprint/plonk/assignment_proxy.hpp>
+
+namespace nil {
+    namespace blueprint {
+
+        /// @brief Field independent handle of `replay_log`, passed to handlers with component parameters.
+        struct replay_log_base {
+            virtual ~replay_log_base() = default;
+        };
+
+        /**
+         * @brief Steps which fill witness values of an evaluated circuit, in evaluation order.
+         *
+         * Once inputs are replaced in their cells, running the steps again reproduces the table of an evaluation
+         * with the new input, without interpretation of the IR and without circuit generation,
+         * as long as the layout of the table is the same.
+         *
+         * The layout depends on input only through cell values the assigner reads on the host: branch
+         * conditions, indices and pointers, values merged into internal storage after a branch. Each such read
+         * is recorded as a guard with the value seen by the recorded evaluation, and replay stops at the first
+         * guard which sees another value. Internal storage and constant cells are computed from the IR and from
+         * guarded cells only, so they need no guards of their own.
+         */
+        template<typename BlueprintFieldType>
+        class replay_log : public replay_log_base {
+        public:
+            using assignment_type = assignment_proxy<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>;
+            using var = crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>;
+            // returns false if the replayed table must not be used
+            using step_type = std::function<bool(assignment_type &)>;
+
+            void record(std::uint32_t prover_idx, step_type step) {
+                steps.emplace_back(prover_idx, std::move(step));
+            }
+
+            /// @brief Require `cell` to hold `value` at this point of replay.
+            void guard(std::uint32_t prover_idx, const var &cell, const typename BlueprintFieldType::value_type &value) {
+                record(prover_idx, [cell, value](assignment_type &replayed) {
+                    return var_value(replayed, cell) == value;
+                });
+            }
+
+            /// @brief Run the steps, false if a guard fails, the table is left partially replayed then.
+            bool replay(std::vector<assignment_type> &assignments) const {
+                for (const auto &[prover_idx, step] : steps) {
+                    if (!step(assignments[prover_idx])) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            std::size_t size() const {
+                return steps.size();
+            }
+
+            void clear() {
+                steps.clear();
+            }
+
+        private:
+            std::vector<std::pair<std::uint32_t, step_type>> steps;
+        };
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_REPLAY_LOG_HPP_
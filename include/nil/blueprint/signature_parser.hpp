@@ -36,6 +36,7 @@
 #include <boost/fusion/include/adapt_struct.hpp>
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <iostream>
 
@@ -226,18 +227,28 @@ namespace nil {
             std::ostringstream error;
         };
 
+        namespace detail {
+            /// @brief Grammar shared by all parsers of a thread, building it is much more expensive than parsing.
+            inline signature_grammar<std::string::const_iterator> &get_signature_grammar() {
+                static thread_local signature_grammar<std::string::const_iterator> grammar;
+                return grammar;
+            }
+        }    // namespace detail
+
         /// @brief Parser of signature string.
         class signature_parser {
         public:
             /// @brief Parse input string into AST. Return `true` on success.
             bool parse(const std::string& str) {
+                auto &grammar = detail::get_signature_grammar();
+                grammar.error.str("");
                 std::string::const_iterator it = str.begin();
                 bool matched = phrase_parse(it, str.end(), grammar, ascii::space, tree);
                 if (matched && it == str.end()) {
                     return true;
                 }
                 error = "Parsing of \"" + str + "\" signature failed";
-                if (grammar.error.str() == "") {
+                if (grammar.error.str() != "") {
                     error += ": " + grammar.error.str();
                 }
                 return false;
@@ -253,10 +264,35 @@ namespace nil {
             }
 
         private:
-            signature_grammar<std::string::const_iterator> grammar;
             std::string error;
             signature_node tree;
         };
+
+        /// @brief Parsed signatures by their strings, elements of big inputs repeat the same few signatures.
+        class signature_cache {
+        public:
+            /// @brief AST of the signature, `nullptr` if it can't be parsed. Pointers stay valid while the cache lives.
+            const signature_node *parse(const std::string &str) {
+                auto it = trees.find(str);
+                if (it != trees.end()) {
+                    return &it->second;
+                }
+                signature_parser sp;
+                if (!sp.parse(str)) {
+                    error = sp.get_error();
+                    return nullptr;
+                }
+                return &trees.emplace(str, sp.get_tree()).first->second;
+            }
+
+            const std::string &get_error() {
+                return error;
+            }
+
+        private:
+            std::unordered_map<std::string, signature_node> trees;
+            std::string error;
+        };
     }    // namespace blueprint
 }    // namespace nil
 
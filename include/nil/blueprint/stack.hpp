@@ -30,10 +30,24 @@
 #include "llvm/IR/Value.h"
 
 #include <map>
+#include <utility>
 #include <vector>
 
 namespace nil {
     namespace blueprint {
+        /**
+         * @brief Native field value `constant + sum(terms)` which is not placed into the circuit yet.
+         */
+        template<typename VarType>
+        struct linear_expression {
+            using value_type = typename VarType::assignment_type;
+
+            /// @brief Variables with their signs, `true` stands for a subtracted term.
+            std::vector<std::pair<VarType, bool>> terms;
+
+            value_type constant = value_type::zero();
+        };
+
         /**
          * @brief Execution frame. Each function call uses its own `stack_frame`, which holds
          * local variables.
@@ -52,6 +66,9 @@ namespace nil {
             /// @brief Registers holding vector values (non-native fields, curves, vectors, etc.).
             vector_regs vectors;
 
+            /// @brief Results of native field additions and subtractions which are not materialized yet.
+            std::map<const llvm::Value *, linear_expression<VarType>> linear_expressions;
+
             const llvm::CallInst *caller;
         };
 
@@ -29,6 +29,20 @@
 namespace nil {
     namespace blueprint {
 
+        /**
+         * @brief Table dimensions measured by a size estimation run.
+         *
+         * Passed to the assigner which generates the same circuit with assignments,
+         * so it can reserve column storage before evaluation instead of growing columns row by row.
+         **/
+        struct table_size_estimation {
+            std::size_t rows_amount = 0;
+            std::size_t constant_rows_amount = 0;
+            std::size_t public_input_rows_amount = 0;
+            std::size_t internal_storage_size = 0;
+            std::size_t memory_cells_amount = 0;
+        };
+
         struct component_statistics {
             std::size_t component_counter;
             std::size_t component_rows;
@@ -56,6 +70,9 @@ namespace nil {
 
             std::map<std::string, component_statistics> components;
 
+            // end of the rows which would be allocated by components, provers share the table
+            std::size_t allocated_rows = 0;
+
             std::set<std::string> unfinished_components = {
                 "non_native fp12 multiplication",
                 "is_in_g1",
@@ -80,6 +97,19 @@ namespace nil {
                 }
             }
 
+            void allocate_rows(std::size_t end_row) {
+                allocated_rows = std::max(allocated_rows, end_row);
+            }
+
+            /// @brief Gates added by all the used components.
+            std::size_t total_gates() const {
+                std::size_t gates = 0;
+                for (const auto& [name, component] : components) {
+                    gates += component.component_gates;
+                }
+                return gates;
+            }
+
             void print() {
                 std::cout << "================\n";
                 std::cout << "statistics:\n";
@@ -25,9 +25,11 @@
 #ifndef ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_UTILITIES_HPP_
 #define ZKLLVM_ASSIGNER_INCLUDE_NIL_BLUEPRINT_UTILITIES_HPP_
 
+#include <algorithm>
 #include <vector>
 #include <array>
 #include <limits>
+#include <cmath>
 
 #include <nil/blueprint/asserts.hpp>
 #include <nil/blueprint/manifest.hpp>
@@ -51,30 +53,40 @@ namespace nil {
             };
 
             struct CompilerRestrictions {
-                inline static compiler_manifest common_restriction_manifest = compiler_manifest(15, // TODO hardcoded
-                                                                                                true);
+                /// @brief Witness columns available to components unless the assigner is given another limit.
+                static constexpr std::uint32_t default_witness_amount = 15;
+            };
+
+            /// @brief Parameters of a component placed with a particular amount of witness columns.
+            struct WitnessVariant {
+                std::uint32_t witness_amount;
+                std::uint32_t rows_amount;
+                std::uint32_t gates_amount;
+
+                /// @brief Rows rounded up to a power of two plus gates, cost of the variant placed in isolation.
+                std::uint32_t isolated_cost() const {
+                    return std::pow(2, std::ceil(std::log2(rows_amount))) + gates_amount;
+                }
             };
 
             template<typename ComponentType>
             struct ManifestReader {
 
                 template<typename... Args>
-                static std::vector <std::pair<std::uint32_t, std::uint32_t>>
-                get_witness(Args... args) {
+                static std::vector<WitnessVariant>
+                get_witness(const compiler_manifest &restriction, Args... args) {
                     typename ComponentType::manifest_type manifest =
-                        CompilerRestrictions::common_restriction_manifest.intersect(ComponentType::get_manifest(args...));
+                        restriction.intersect(ComponentType::get_manifest(args...));
                     ASSERT(manifest.is_satisfiable());
                     auto witness_amount_ptr = manifest.witness_amount;
-                    std::vector <std::pair<std::uint32_t, std::uint32_t>> values;
+                    std::vector<WitnessVariant> values;
                     for (auto it = witness_amount_ptr->begin();
                          it != witness_amount_ptr->end(); it++) {
-                        const auto witness_amount = *it;
-                        const auto rows_amount = ComponentType::get_rows_amount(witness_amount,
-                                                                                args...);
-                        const auto total_amount_rows_power_two = std::pow(2, std::ceil(std::log2(rows_amount)));
-                        const auto total_amount_of_gates = ComponentType::get_gate_manifest(witness_amount, args...).get_gates_amount();
-                        values.emplace_back(witness_amount,
-                                            total_amount_rows_power_two + total_amount_of_gates);
+                        const std::uint32_t witness_amount = *it;
+                        const std::uint32_t rows_amount = ComponentType::get_rows_amount(witness_amount,
+                                                                                         args...);
+                        const std::uint32_t total_amount_of_gates = ComponentType::get_gate_manifest(witness_amount, args...).get_gates_amount();
+                        values.push_back({witness_amount, rows_amount, total_amount_of_gates});
                     }
                     ASSERT(values.size() > 0);
                     return values;
@@ -112,6 +124,15 @@ namespace nil {
                 return var(1, constant_idx, false, var::column_type::constant);
             }
 
+            /// @brief Copy of `column` with storage for `size` rows, the content is unchanged.
+            template<typename ColumnType>
+            ColumnType reserved_column(const ColumnType &column, std::size_t size) {
+                ColumnType reserved;
+                reserved.reserve(std::max(size, column.size()));
+                reserved.insert(reserved.end(), column.begin(), column.end());
+                return reserved;
+            }
+
             static constexpr const std::size_t internal_storage_index = std::numeric_limits<std::size_t>::max();
 
             template<typename InputType, typename BlueprintFieldType, typename var>
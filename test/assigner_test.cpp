@@ -0,0 +1,653 @@
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+
+#include <nil/blueprint/assigner.hpp>
+#include <nil/blueprint/autotune.hpp>
+
+#define BOOST_TEST_MODULE assigner_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/json/parse.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+
+using namespace nil::blueprint;
+using BlueprintFieldType = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+using assigner_type = assigner<BlueprintFieldType>;
+
+constexpr long test_stack_size = 4000;
+
+nil::crypto3::zk::snark::plonk_table_description<BlueprintFieldType> test_table_description() {
+    return nil::crypto3::zk::snark::plonk_table_description<BlueprintFieldType>(15, 1, 5, 50);
+}
+
+std::unique_ptr<assigner_type> make_assigner(const std::string &ir_name, generation_mode gen_mode,
+                                             const std::string &policy = "") {
+    auto result = std::make_unique<assigner_type>(test_table_description(), test_stack_size,
+                                                  boost::log::trivial::error, 1,
+                                                  std::numeric_limits<std::uint32_t>::max(), gen_mode, policy);
+    const std::string ir_file = std::string(IR_DIR) + "/" + ir_name;
+    BOOST_TEST_REQUIRE(result->parse_ir_file(ir_file.c_str()));
+    return result;
+}
+
+boost::json::array parse_input(const char *input) {
+    return boost::json::parse(input).as_array();
+}
+
+bool same_columns(const assignment_proxy<assigner_type::ArithmetizationType> &a,
+                  const assignment_proxy<assigner_type::ArithmetizationType> &b) {
+    const auto desc = test_table_description();
+    for (std::uint32_t i = 0; i < desc.witness_columns; i++) {
+        if (a.witness(i) != b.witness(i)) {
+            return false;
+        }
+    }
+    for (std::uint32_t i = 0; i < desc.constant_columns; i++) {
+        if (a.constant(i) != b.constant(i)) {
+            return false;
+        }
+    }
+    for (std::uint32_t i = 0; i < desc.selector_columns; i++) {
+        if (a.selector(i) != b.selector(i)) {
+            return false;
+        }
+    }
+    return a.public_input(0) == b.public_input(0);
+}
+
+const boost::json::array empty_input;
+
+BOOST_AUTO_TEST_SUITE(assigner_suite)
+
+BOOST_AUTO_TEST_CASE(assigner_reserve_table_from_estimation) {
+    const auto input = parse_input(R"([{"field": 3}, {"field": 5}])");
+
+    auto estimator = make_assigner("field_arithmetic.ll", generation_mode::size_estimation());
+    estimator->set_print_statistics(false);
+    BOOST_TEST_REQUIRE(estimator->evaluate(input, empty_input));
+    const table_size_estimation estimation = estimator->get_table_size_estimation();
+    BOOST_TEST(estimation.rows_amount > 0);
+
+    const generation_mode full_mode = generation_mode::circuit() | generation_mode::assignments();
+    auto plain = make_assigner("field_arithmetic.ll", full_mode);
+    BOOST_TEST_REQUIRE(plain->evaluate(input, empty_input));
+
+    auto reserved = make_assigner("field_arithmetic.ll", full_mode);
+    reserved->reserve_table(estimation);
+    BOOST_TEST(reserved->assignments[0].witness(0).capacity() >= estimation.rows_amount);
+    BOOST_TEST(reserved->assignments[0].constant(1).capacity() >= estimation.constant_rows_amount);
+    BOOST_TEST_REQUIRE(reserved->evaluate(input, empty_input));
+
+    BOOST_TEST(reserved->assignments[0].allocated_rows() == plain->assignments[0].allocated_rows());
+    BOOST_TEST(reserved->assignments[0].allocated_rows() == estimation.rows_amount);
+    BOOST_TEST(same_columns(reserved->assignments[0], plain->assignments[0]));
+    BOOST_TEST((reserved->get_return_value() == plain->get_return_value()));
+}
+
+BOOST_AUTO_TEST_CASE(assigner_packing_estimation_matches_layout) {
+    const auto input = parse_input(R"([{"field": 3}, {"field": 5}])");
+    const generation_mode full_mode = generation_mode::circuit() | generation_mode::assignments();
+
+    auto estimator = make_assigner("field_arithmetic.ll", generation_mode::size_estimation(), "packing");
+    estimator->set_print_statistics(false);
+    BOOST_TEST_REQUIRE(estimator->evaluate(input, empty_input));
+
+    auto first = make_assigner("field_arithmetic.ll", full_mode, "packing");
+    BOOST_TEST_REQUIRE(first->evaluate(input, empty_input));
+    BOOST_TEST(first->assignments[0].allocated_rows() == estimator->get_table_size_estimation().rows_amount);
+
+    // Packer of the first assigner must not affect placement of the second one
+    auto second = make_assigner("field_arithmetic.ll", full_mode, "packing");
+    BOOST_TEST_REQUIRE(second->evaluate(input, empty_input));
+    BOOST_TEST(second->assignments[0].allocated_rows() == first->assignments[0].allocated_rows());
+    BOOST_TEST(same_columns(second->assignments[0], first->assignments[0]));
+}
+
+BOOST_AUTO_TEST_CASE(assigner_packing_saves_rows) {
+    const auto input = parse_input(R"([{"field": 2}, {"field": 3}, {"field": 5}, {"field": 7}])");
+    const auto estimate_rows = [&input](const std::string &policy) {
+        auto estimator = make_assigner("independent_multiplications.ll", generation_mode::size_estimation(), policy);
+        estimator->set_print_statistics(false);
+        BOOST_TEST_REQUIRE(estimator->evaluate(input, empty_input));
+        return estimator->get_table_size_estimation().rows_amount;
+    };
+
+    // six multiplications of three witnesses each share rows of a 15 columns wide layout
+    BOOST_TEST(estimate_rows("packing") < estimate_rows("default"));
+}
+
+BOOST_AUTO_TEST_CASE(assigner_constant_affine_fusion) {
+    const auto input = parse_input(R"([{"field": 4}])");
+
+    auto estimator = make_assigner("constant_affine.ll", generation_mode::size_estimation());
+    estimator->set_print_statistics(false);
+    BOOST_TEST_REQUIRE(estimator->evaluate(input, empty_input));
+    // 3 * x + 5 is a single affine map, 2 * (...) is another one
+    const auto &components = estimator->get_statistics().components;
+    const auto affine = components.find("native field affine map with constant coefficients");
+    BOOST_TEST_REQUIRE((affine != components.end()));
+    BOOST_TEST(affine->second.component_counter == 2u);
+
+    // coefficients are kept by the affine maps, so they take no cells of the constant column
+    auto reference = make_assigner("independent_multiplications.ll", generation_mode::size_estimation());
+    reference->set_print_statistics(false);
+    BOOST_TEST_REQUIRE(reference->evaluate(parse_input(R"([{"field": 2}, {"field": 3}, {"field": 5}, {"field": 7}])"),
+                                           empty_input));
+    BOOST_TEST(estimator->get_table_size_estimation().constant_rows_amount ==
+               reference->get_table_size_estimation().constant_rows_amount);
+
+    auto full = make_assigner("constant_affine.ll", generation_mode::circuit() | generation_mode::assignments());
+    BOOST_TEST_REQUIRE(full->evaluate(input, empty_input));
+    const auto result = full->get_return_value();
+    BOOST_TEST_REQUIRE(result.size() == 1u);
+    BOOST_TEST((result[0] == 1156));
+}
+
+std::size_t component_count(const assigner_type &estimator, const std::string &name) {
+    const auto &components = estimator.get_statistics().components;
+    const auto it = components.find(name);
+    return it == components.end() ? 0 : it->second.component_counter;
+}
+
+BOOST_AUTO_TEST_CASE(assigner_lazy_linear_expressions) {
+    const std::string linear_combination = "native field linear combination";
+    const generation_mode full_mode = generation_mode::circuit() | generation_mode::assignments();
+    struct linear_case {
+        std::string ir_name;
+        const char *input;
+        std::uint32_t witness_limit;
+        std::size_t combinations;
+        int result;
+    };
+    const std::vector<linear_case> cases = {
+        // a + b - c + d + e is a single sum materialized at return
+        {"linear_chain.ll", R"([{"field": 2}, {"field": 3}, {"field": 5}, {"field": 7}, {"field": 11}])", 0, 1, 18},
+        // 3 terms at most: a + b - c is materialized before d is added
+        {"linear_chain.ll", R"([{"field": 2}, {"field": 3}, {"field": 5}, {"field": 7}, {"field": 11}])", 4, 2, 18},
+        // the expression passes through phi and is materialized at return
+        {"linear_phi.ll", R"([{"field": 2}, {"field": 3}, {"field": 4}])", 0, 1, 8},
+        // the expression is materialized at store
+        {"linear_store.ll", R"([{"field": 2}, {"field": 3}, {"field": 5}])", 0, 1, 20},
+        // a + b and b - a are placed by addition and subtraction, only div + constant is a linear combination
+        {"field_arithmetic.ll", R"([{"field": 3}, {"field": 5}])", 0, 1, 0},
+    };
+
+    for (const auto &test_case : cases) {
+        BOOST_TEST_CONTEXT(test_case.ir_name << ", witness limit " << test_case.witness_limit) {
+            const auto input = parse_input(test_case.input);
+            auto estimator = make_assigner(test_case.ir_name, generation_mode::size_estimation());
+            estimator->set_print_statistics(false);
+            if (test_case.witness_limit != 0) {
+                estimator->set_witness_limit(test_case.witness_limit);
+            }
+            BOOST_TEST_REQUIRE(estimator->evaluate(input, empty_input));
+            BOOST_TEST(component_count(*estimator, linear_combination) == test_case.combinations);
+
+            auto full = make_assigner(test_case.ir_name, full_mode);
+            if (test_case.witness_limit != 0) {
+                full->set_witness_limit(test_case.witness_limit);
+            }
+            BOOST_TEST_REQUIRE(full->evaluate(input, empty_input));
+            const auto result = full->get_return_value();
+            BOOST_TEST_REQUIRE(result.size() == 1u);
+            if (test_case.result != 0) {
+                BOOST_TEST((result[0] == test_case.result));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(assigner_repeated_comparison_is_memoised) {
+    const auto input = parse_input(R"([{"int": 3}, {"int": 5}])");
+    const generation_mode full_mode = generation_mode::circuit() | generation_mode::assignments();
+
+    auto single = make_assigner("single_comparison.ll", full_mode);
+    BOOST_TEST_REQUIRE(single->evaluate(input, empty_input));
+    auto repeated = make_assigner("repeated_comparison.ll", full_mode);
+    BOOST_TEST_REQUIRE(repeated->evaluate(input, empty_input));
+    // the second comparison takes the flag of the first one
+    BOOST_TEST(repeated->assignments[0].allocated_rows() == single->assignments[0].allocated_rows());
+    BOOST_TEST((repeated->get_return_value() == single->get_return_value()));
+    BOOST_TEST((repeated->get_return_value()[0] == 2));
+
+    // estimation must skip the same components as the real run
+    auto estimator = make_assigner("repeated_comparison.ll", generation_mode::size_estimation());
+    estimator->set_print_statistics(false);
+    BOOST_TEST_REQUIRE(estimator->evaluate(input, empty_input));
+    BOOST_TEST(estimator->get_table_size_estimation().rows_amount == repeated->assignments[0].allocated_rows());
+}
+
+BOOST_AUTO_TEST_CASE(assigner_narrow_bitwise_bounds_top_byte) {
+    const auto input = parse_input(R"([{"int": 5}, {"int": 6}])");
+
+    auto estimator = make_assigner("narrow_bitwise.ll", generation_mode::size_estimation());
+    estimator->set_print_statistics(false);
+    BOOST_TEST_REQUIRE(estimator->evaluate(input, empty_input));
+    const auto &components = estimator->get_statistics().components;
+    const auto bitwise_and = components.find("bitwise and");
+    BOOST_TEST_REQUIRE((bitwise_and != components.end()));
+    // composition, byte lookups and the 4-bit bound of the only byte
+    BOOST_TEST(bitwise_and->second.component_gates == 3u);
+
+    auto full = make_assigner("narrow_bitwise.ll", generation_mode::circuit() | generation_mode::assignments());
+    BOOST_TEST_REQUIRE(full->evaluate(input, empty_input));
+    BOOST_TEST((full->get_return_value()[0] == 4));
+    BOOST_TEST(full->circuits[0].lookup_gates().size() == 2u);
+
+    // i4 operands out of range are rejected by the input
+    auto wide = make_assigner("narrow_bitwise.ll", generation_mode::circuit() | generation_mode::assignments());
+    BOOST_TEST(!wide->evaluate(parse_input(R"([{"int": 17}, {"int": 6}])"), empty_input));
+}
+
+BOOST_AUTO_TEST_CASE(assigner_fixed_base_multiplication) {
+    const char *base_x = "0x216936d3cd6e53fec0a4e231fdd6dc5c692cc7609525a7b2c9562d608f25d51a";
+    const char *base_y = "0x6666666666666666666666666666666666666666666666666666666666666658";
+    const generation_mode full_mode = generation_mode::circuit() | generation_mode::assignments();
+
+    auto fixed = make_assigner("fixed_base_multiplication.ll", full_mode);
+    BOOST_TEST_REQUIRE(fixed->evaluate(parse_input(R"([{"field": 12345}])"), empty_input));
+
+    const std::string variable_input =
+        std::string(R"([{"curve": [")") + base_x + R"(", ")" + base_y + R"("]}, {"field": 12345}])";
+    auto variable = make_assigner("variable_base_multiplication.ll", full_mode);
+    BOOST_TEST_REQUIRE(variable->evaluate(parse_input(variable_input.c_str()), empty_input));
+    BOOST_TEST((fixed->get_return_value() == variable->get_return_value()));
+
+    // the constant base point takes the window path, a point from the input never does
+    auto fixed_estimator = make_assigner("fixed_base_multiplication.ll", generation_mode::size_estimation());
+    fixed_estimator->set_print_statistics(false);
+    BOOST_TEST_REQUIRE(fixed_estimator->evaluate(parse_input(R"([{"field": 12345}])"), empty_input));
+    BOOST_TEST(fixed_estimator->get_statistics().components.count("window selection") == 1u);
+
+    auto variable_estimator = make_assigner("variable_base_multiplication.ll", generation_mode::size_estimation());
+    variable_estimator->set_print_statistics(false);
+    BOOST_TEST_REQUIRE(variable_estimator->evaluate(parse_input(variable_input.c_str()), empty_input));
+    BOOST_TEST(variable_estimator->get_statistics().components.count("window selection") == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(assigner_extended_intrinsic_handlers_compile) {
+    // handlers are instantiated even if this build does not dispatch their intrinsics
+    BOOST_TEST(&handle_curve_msm_component<BlueprintFieldType> != nullptr);
+    BOOST_TEST(&handle_poseidon_sponge_component<BlueprintFieldType> != nullptr);
+    BOOST_TEST(&handle_sha2_256_stream_component<BlueprintFieldType> != nullptr);
+}
+
+#ifdef ASSIGNER_EXTENDED_INTRINSICS
+BOOST_AUTO_TEST_CASE(assigner_msm_matches_scalar_multiplication) {
+    const std::string point = R"({"curve": ["0x216936d3cd6e53fec0a4e231fdd6dc5c692cc7609525a7b2c9562d608f25d51a", )"
+                              R"("0x6666666666666666666666666666666666666666666666666666666666666658"]})";
+    const generation_mode full_mode = generation_mode::circuit() | generation_mode::assignments();
+
+    // [5]B + [7]B == [12]B, msm is implemented for curve25519 only
+    const std::string msm_input = R"([{"array": [)" + point + ", " + point + R"(]}, {"array": [{"field": 5}, {"field": 7}]}])";
+    auto msm = make_assigner("msm.ll", full_mode);
+    BOOST_TEST_REQUIRE(msm->evaluate(parse_input(msm_input.c_str()), empty_input));
+
+    const std::string multiplication_input = "[" + point + R"(, {"field": 12}])";
+    auto multiplication = make_assigner("variable_base_multiplication.ll", full_mode);
+    BOOST_TEST_REQUIRE(multiplication->evaluate(parse_input(multiplication_input.c_str()), empty_input));
+    BOOST_TEST((msm->get_return_value() == multiplication->get_return_value()));
+}
+#endif
+
+#ifdef ASSIGNER_EXTENDED_INTRINSICS
+BOOST_AUTO_TEST_CASE(assigner_poseidon_sponge) {
+    const generation_mode full_mode = generation_mode::circuit() | generation_mode::assignments();
+    const auto hash = [&full_mode](const std::string &ir_name, const char *input) {
+        auto full = make_assigner(ir_name, full_mode);
+        BOOST_TEST_REQUIRE(full->evaluate(parse_input(input), empty_input));
+        const auto result = full->get_return_value();
+        BOOST_TEST_REQUIRE(result.size() == 1u);
+        return result[0];
+    };
+
+    // the capacity lane starts from the length, so a trailing zero changes the hash
+    BOOST_TEST((hash("poseidon_sponge_1.ll", R"([{"array": [{"field": 3}]}])") !=
+                hash("poseidon_sponge_2.ll", R"([{"array": [{"field": 3}, {"field": 0}]}])")));
+
+    // 5 elements take 3 permutations
+    BOOST_TEST((hash("poseidon_sponge_5.ll",
+                     R"([{"array": [{"field": 2}, {"field": 3}, {"field": 5}, {"field": 7}, {"field": 11}]}])") ==
+                hash("poseidon_sponge_reference.ll",
+                     R"([{"field": 2}, {"field": 3}, {"field": 5}, {"field": 7}, {"field": 11}])")));
+}
+
+BOOST_AUTO_TEST_CASE(assigner_sha2_256_stream_multi_block) {
+    // 56 bytes take two blocks after padding
+    const std::string message = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    boost::json::array bytes;
+    for (const char c : message) {
+        bytes.push_back(boost::json::object({{"int", static_cast<int>(c)}}));
+    }
+    boost::json::array input;
+    input.push_back(boost::json::object({{"array", bytes}}));
+
+    auto full = make_assigner("sha2_256_stream.ll", generation_mode::circuit() | generation_mode::assignments());
+    BOOST_TEST_REQUIRE(full->evaluate(input, empty_input));
+    const auto digest = full->get_return_value();
+    BOOST_TEST_REQUIRE(digest.size() == 2u);
+    // SHA-256 of the message is 248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1
+    using integral_type = typename BlueprintFieldType::integral_type;
+    BOOST_TEST((digest[0] == integral_type("0x248d6a61d20638b8e5c026930c3e6039")));
+    BOOST_TEST((digest[1] == integral_type("0xa33ce45964ff2167f6ecedd419db06c1")));
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(assigner_binary_input_is_checked) {
+    using value_type = typename BlueprintFieldType::value_type;
+    const generation_mode full_mode = generation_mode::circuit() | generation_mode::assignments();
+    const std::vector<binary_input::argument> layout = {{false, 1}, {false, 1}};
+    const std::string file_name = "assigner_binary_input_is_checked.bin";
+
+    BOOST_TEST_REQUIRE(write_binary_input<BlueprintFieldType>(file_name, layout, {value_type(5), value_type(6)}, {}));
+    binary_input valid;
+    BOOST_TEST_REQUIRE(valid.open(file_name));
+    auto narrow = make_assigner("narrow_bitwise.ll", full_mode);
+    BOOST_TEST_REQUIRE(narrow->evaluate(valid));
+    BOOST_TEST((narrow->get_return_value()[0] == 4));
+    valid.close();
+
+    // i4 operand out of range
+    BOOST_TEST_REQUIRE(write_binary_input<BlueprintFieldType>(file_name, layout, {value_type(17), value_type(6)}, {}));
+    binary_input wide;
+    BOOST_TEST_REQUIRE(wide.open(file_name));
+    auto wide_assigner = make_assigner("narrow_bitwise.ll", full_mode);
+    BOOST_TEST(!wide_assigner->evaluate(wide));
+    wide.close();
+
+    // field element which is not below the modulus
+    BOOST_TEST_REQUIRE(write_binary_input<BlueprintFieldType>(file_name, layout, {value_type(3), value_type(5)}, {}));
+    {
+        std::fstream file(file_name, std::ios::binary | std::ios::in | std::ios::out);
+        const std::size_t element_bytes = binary_input::element_bytes_for<BlueprintFieldType>();
+        file.seekp(-static_cast<std::streamoff>(element_bytes), std::ios::end);
+        const std::string all_ones(element_bytes, static_cast<char>(0xFF));
+        file.write(all_ones.data(), all_ones.size());
+    }
+    binary_input unreduced;
+    BOOST_TEST_REQUIRE(unreduced.open(file_name));
+    auto field_assigner = make_assigner("field_arithmetic.ll", full_mode);
+    BOOST_TEST(!field_assigner->evaluate(unreduced));
+    unreduced.close();
+
+    std::remove(file_name.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(assigner_batch_keeps_circuit) {
+    const std::vector<const char *> inputs = {R"([{"field": 3}, {"field": 5}])", R"([{"field": 7}, {"field": 11}])"};
+    const generation_mode full_mode = generation_mode::circuit() | generation_mode::assignments();
+
+    auto batch = make_assigner("field_arithmetic.ll", full_mode);
+    std::size_t gates_amount = 0;
+    std::size_t copy_constraints_amount = 0;
+    std::size_t next = 0;
+    BOOST_TEST_REQUIRE(batch->evaluate_batch(
+        [&](boost::json::array &public_input, boost::json::array &private_input) {
+            if (next == inputs.size()) {
+                return false;
+            }
+            public_input = parse_input(inputs[next++]);
+            return true;
+        },
+        [&](std::size_t idx) {
+            if (idx == 0) {
+                gates_amount = batch->circuits[0].gates().size();
+                copy_constraints_amount = batch->circuits[0].copy_constraints().size();
+            }
+        }));
+    BOOST_TEST_REQUIRE(next == inputs.size());
+    BOOST_TEST(batch->circuits[0].gates().size() == gates_amount);
+    BOOST_TEST(batch->circuits[0].copy_constraints().size() == copy_constraints_amount);
+
+    // the second table, selectors included, is the one of a separate run
+    auto single = make_assigner("field_arithmetic.ll", full_mode);
+    BOOST_TEST_REQUIRE(single->evaluate(parse_input(inputs[1]), empty_input));
+    BOOST_TEST(batch->assignments[0].allocated_rows() == single->assignments[0].allocated_rows());
+    BOOST_TEST(same_columns(batch->assignments[0], single->assignments[0]));
+    BOOST_TEST(single->circuits[0].copy_constraints().size() == copy_constraints_amount);
+}
+
+BOOST_AUTO_TEST_CASE(assigner_circuit_cache_round_trip) {
+    const auto first_input = parse_input(R"([{"int": 5}, {"int": 6}])");
+    const auto second_input = parse_input(R"([{"int": 3}, {"int": 9}])");
+    const generation_mode full_mode = generation_mode::circuit() | generation_mode::assignments();
+    const std::string cache_dir = "assigner_circuit_cache_round_trip";
+    std::filesystem::remove_all(cache_dir);
+    std::filesystem::create_directory(cache_dir);
+
+    auto generator = make_assigner("narrow_bitwise.ll", full_mode);
+    BOOST_TEST_REQUIRE(generator->evaluate(first_input, empty_input));
+    BOOST_TEST_REQUIRE(generator->store_circuit_in_cache(cache_dir));
+
+    auto cached = make_assigner("narrow_bitwise.ll", generation_mode::assignments());
+    BOOST_TEST_REQUIRE(cached->load_cached_circuit(cache_dir));
+    BOOST_TEST_REQUIRE(cached->evaluate(second_input, empty_input));
+
+    const auto &stored = generator->circuits[0];
+    const auto &loaded = cached->circuits[0];
+    BOOST_TEST(loaded.gates().size() == stored.gates().size());
+    BOOST_TEST(loaded.copy_constraints().size() == stored.copy_constraints().size());
+    BOOST_TEST(loaded.lookup_gates().size() == stored.lookup_gates().size());
+    BOOST_TEST_REQUIRE(!stored.get_reserved_indices().empty());
+    BOOST_TEST((loaded.get_reserved_indices() == stored.get_reserved_indices()));
+    BOOST_TEST_REQUIRE(cached->get_cached_usage().size() == 1u);
+    BOOST_TEST((cached->get_cached_usage()[0] == circuit_cache::usage::of(stored)));
+
+    // the table, selectors included, is the one of a run which generates the circuit
+    auto single = make_assigner("narrow_bitwise.ll", full_mode);
+    BOOST_TEST_REQUIRE(single->evaluate(second_input, empty_input));
+    BOOST_TEST(cached->assignments[0].allocated_rows() == single->assignments[0].allocated_rows());
+    BOOST_TEST(same_columns(cached->assignments[0], single->assignments[0]));
+    BOOST_TEST((cached->get_return_value() == single->get_return_value()));
+
+    // a circuit generated under another witness limit is not taken
+    auto narrower = make_assigner("narrow_bitwise.ll", generation_mode::assignments());
+    narrower->set_witness_limit(10);
+    BOOST_TEST(!narrower->load_cached_circuit(cache_dir));
+
+    std::filesystem::remove_all(cache_dir);
+}
+
+BOOST_AUTO_TEST_CASE(assigner_fast_evaluation_takes_no_rows) {
+    const std::string input = R"([{"curve": ["0x216936d3cd6e53fec0a4e231fdd6dc5c692cc7609525a7b2c9562d608f25d51a", )"
+                              R"("0x6666666666666666666666666666666666666666666666666666666666666658"]}, {"field": 12345}])";
+    const generation_mode full_mode = generation_mode::circuit() | generation_mode::assignments();
+
+    auto full = make_assigner("variable_base_multiplication.ll", full_mode);
+    BOOST_TEST_REQUIRE(full->evaluate(parse_input(input.c_str()), empty_input));
+
+    // the multiplication is not folded, its component is assigned aside
+    auto fast = make_assigner("variable_base_multiplication.ll", generation_mode::fast_evaluation());
+    BOOST_TEST_REQUIRE(fast->evaluate(parse_input(input.c_str()), empty_input));
+    BOOST_TEST((fast->get_return_value() == full->get_return_value()));
+    BOOST_TEST(fast->get_exit_check_failures() == 0u);
+    BOOST_TEST(fast->circuits[0].gates().empty());
+    BOOST_TEST(fast->circuits[0].copy_constraints().empty());
+    for (std::uint32_t i = 0; i < test_table_description().witness_columns; i++) {
+        BOOST_TEST(fast->assignments[0].witness(i).empty());
+    }
+    for (std::uint32_t i = 0; i < test_table_description().selector_columns; i++) {
+        BOOST_TEST(fast->assignments[0].selector(i).empty());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(assigner_replay_matches_full_run) {
+    struct replay_case {
+        const char *ir_name;
+        const char *recorded_input;
+        const char *replayed_input;
+        const char *recorded_private_input = "[]";
+        const char *replayed_private_input = "[]";
+    };
+    const generation_mode full_mode = generation_mode::circuit() | generation_mode::assignments();
+    const std::vector<replay_case> cases = {
+        {"field_arithmetic.ll", R"([{"field": 3}, {"field": 5}])", R"([{"field": 7}, {"field": 11}])"},
+        // the branch condition keeps its value
+        {"branch_on_input.ll", R"([{"int": 3}, {"int": 5}])", R"([{"int": 4}, {"int": 9}])"},
+        // private elements are overwritten in private storage and read by components through
+        // the array pointer kept in internal storage
+        {"private_array_product.ll", R"([{"field": 3}])", R"([{"field": 3}])",
+         R"([{"array": [{"field": 5}, {"field": 7}]}])", R"([{"array": [{"field": 11}, {"field": 13}]}])"},
+    };
+    for (const auto &c : cases) {
+        auto replayed = make_assigner(c.ir_name, full_mode);
+        replayed->record_replay();
+        BOOST_TEST_REQUIRE(
+            replayed->evaluate(parse_input(c.recorded_input), parse_input(c.recorded_private_input)));
+        BOOST_TEST_REQUIRE(
+            replayed->replay_evaluation(parse_input(c.replayed_input), parse_input(c.replayed_private_input)));
+
+        auto full = make_assigner(c.ir_name, full_mode);
+        BOOST_TEST_REQUIRE(full->evaluate(parse_input(c.replayed_input), parse_input(c.replayed_private_input)));
+        BOOST_TEST(replayed->assignments[0].allocated_rows() == full->assignments[0].allocated_rows());
+        BOOST_TEST(same_columns(replayed->assignments[0], full->assignments[0]), c.ir_name);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(assigner_replay_refuses_other_branch) {
+    const generation_mode full_mode = generation_mode::circuit() | generation_mode::assignments();
+    auto replayed = make_assigner("branch_on_input.ll", full_mode);
+    replayed->record_replay();
+    BOOST_TEST_REQUIRE(replayed->evaluate(parse_input(R"([{"int": 3}, {"int": 5}])"), empty_input));
+    BOOST_TEST(!replayed->replay_evaluation(parse_input(R"([{"int": 9}, {"int": 4}])"), empty_input));
+}
+
+BOOST_AUTO_TEST_CASE(assigner_column_budget_too_narrow) {
+    // bitwise components need more than 5 witness columns, the run fails instead of aborting
+    auto narrow = make_assigner("narrow_bitwise.ll", generation_mode::circuit() | generation_mode::assignments(),
+                                "column_budget:5");
+    BOOST_TEST(!narrow->evaluate(parse_input(R"([{"int": 5}, {"int": 6}])"), empty_input));
+}
+
+BOOST_AUTO_TEST_CASE(assigner_min_rows_policy) {
+    const auto input = parse_input(R"([{"field": 3}, {"field": 5}])");
+    const generation_mode full_mode = generation_mode::circuit() | generation_mode::assignments();
+
+    std::map<std::string, std::size_t> estimated_rows;
+    for (const char *policy : {"default", "min_rows"}) {
+        auto estimator = make_assigner("field_arithmetic.ll", generation_mode::size_estimation(), policy);
+        estimator->set_print_statistics(false);
+        BOOST_TEST_REQUIRE(estimator->evaluate(input, empty_input));
+        estimated_rows[policy] = estimator->get_table_size_estimation().rows_amount;
+    }
+    BOOST_TEST(estimated_rows["min_rows"] <= estimated_rows["default"]);
+
+    auto plain = make_assigner("field_arithmetic.ll", full_mode, "default");
+    BOOST_TEST_REQUIRE(plain->evaluate(input, empty_input));
+    auto min_rows = make_assigner("field_arithmetic.ll", full_mode, "min_rows");
+    BOOST_TEST_REQUIRE(min_rows->evaluate(input, empty_input));
+    BOOST_TEST(min_rows->assignments[0].allocated_rows() == estimated_rows["min_rows"]);
+    BOOST_TEST((min_rows->get_return_value() == plain->get_return_value()));
+}
+
+BOOST_AUTO_TEST_CASE(assigner_witness_limit_is_per_assigner) {
+    const auto input = parse_input(R"([{"field": 3}, {"field": 5}])");
+    const auto estimate_rows = [&input](std::uint32_t witness_limit) {
+        auto estimator = make_assigner("field_arithmetic.ll", generation_mode::size_estimation());
+        estimator->set_print_statistics(false);
+        if (witness_limit != 0) {
+            estimator->set_witness_limit(witness_limit);
+        }
+        BOOST_TEST_REQUIRE(estimator->evaluate(input, empty_input));
+        return estimator->get_table_size_estimation().rows_amount;
+    };
+
+    const std::size_t default_rows = estimate_rows(0);
+    estimate_rows(10);
+    BOOST_TEST(estimate_rows(0) == default_rows);
+}
+
+BOOST_AUTO_TEST_CASE(assigner_evaluate_autotune_candidate) {
+    const auto input = parse_input(R"([{"field": 3}, {"field": 5}])");
+    const std::string ir_file = std::string(IR_DIR) + "/field_arithmetic.ll";
+
+    autotune_candidate candidate;
+    candidate.witness_limit = 10;
+    candidate.policy = "min_rows";
+    BOOST_TEST(!evaluate_candidate<BlueprintFieldType>(candidate, ir_file.c_str(), test_table_description(),
+                                                       test_stack_size, input, empty_input));
+
+    candidate.succeeded = true;
+    const auto tuned = evaluate_candidate<BlueprintFieldType>(
+        candidate, ir_file.c_str(), test_table_description(), test_stack_size, input, empty_input, 1,
+        std::numeric_limits<std::uint32_t>::max(), generation_mode::circuit() | generation_mode::assignments(),
+        boost::log::trivial::error);
+    BOOST_TEST_REQUIRE(tuned);
+    BOOST_TEST(tuned->assignments[0].witnesses_amount() == 10);
+    BOOST_TEST(tuned->assignments[0].allocated_rows() > 0);
+}
+
+BOOST_AUTO_TEST_CASE(assigner_comparison_is_proven_again_by_next_prover) {
+    const auto input = parse_input(R"([{"int": 3}, {"int": 5}])");
+    const auto count_components = [&input](const std::string &ir_name, std::uint32_t max_num_provers) {
+        assigner_type estimator(test_table_description(), test_stack_size, boost::log::trivial::error,
+                                max_num_provers, std::numeric_limits<std::uint32_t>::max(),
+                                generation_mode::size_estimation());
+        estimator.set_print_statistics(false);
+        const std::string ir_file = std::string(IR_DIR) + "/" + ir_name;
+        BOOST_TEST_REQUIRE(estimator.parse_ir_file(ir_file.c_str()));
+        BOOST_TEST_REQUIRE(estimator.evaluate(input, empty_input));
+        std::size_t result = 0;
+        for (const auto &component : estimator.get_statistics().components) {
+            result += component.second.component_counter;
+        }
+        return result;
+    };
+
+    // the flag of the first prover lives in its own table, so the second prover compares again
+    BOOST_TEST(count_components("comparison_across_provers.ll", 2) > count_components("repeated_comparison.ll", 1));
+
+    assigner_type full(test_table_description(), test_stack_size, boost::log::trivial::error, 2,
+                       std::numeric_limits<std::uint32_t>::max(),
+                       generation_mode::circuit() | generation_mode::assignments());
+    const std::string ir_file = std::string(IR_DIR) + "/comparison_across_provers.ll";
+    BOOST_TEST_REQUIRE(full.parse_ir_file(ir_file.c_str()));
+    BOOST_TEST_REQUIRE(full.evaluate(input, empty_input));
+    BOOST_TEST_REQUIRE(full.assignments.size() == 2u);
+    BOOST_TEST(full.assignments[1].allocated_rows() > 0u);
+    BOOST_TEST((full.get_return_value()[0] == 2));
+}
+
+BOOST_AUTO_TEST_CASE(assigner_runtime_shift_matches_host) {
+    const generation_mode full_mode = generation_mode::circuit() | generation_mode::assignments();
+
+    for (const std::uint32_t bitness : {8u, 32u, 64u}) {
+        const std::uint64_t mask = bitness == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << bitness) - 1;
+        for (const std::uint64_t x : {std::uint64_t(0xA5A5A5A5A5A5A5A5) & mask, mask}) {
+            for (const std::uint32_t shift : {0u, 1u, bitness / 2, bitness - 1}) {
+                for (const bool right : {false, true}) {
+                    BOOST_TEST_CONTEXT("i" << bitness << ", x = " << x << ", s = " << shift << ", right = " << right) {
+                        boost::json::array input;
+                        input.push_back(boost::json::object({{"int", x}}));
+                        input.push_back(boost::json::object({{"int", shift}}));
+                        input.push_back(boost::json::object({{"int", right ? 1 : 0}}));
+
+                        auto full = make_assigner("runtime_shift_i" + std::to_string(bitness) + ".ll", full_mode);
+                        BOOST_TEST_REQUIRE(full->evaluate(input, empty_input));
+                        const auto result = full->get_return_value();
+                        BOOST_TEST_REQUIRE(result.size() == 1u);
+                        const std::uint64_t expected = right ? x >> shift : (x << shift) & mask;
+                        BOOST_TEST((result[0] == expected));
+                    }
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(assigner_malformed_policy) {
+    const auto input = parse_input(R"([{"field": 3}, {"field": 5}])");
+    const generation_mode full_mode = generation_mode::circuit() | generation_mode::assignments();
+    for (const char *policy : {"column_budget", "column_budget:", "column_budget:12x", "column_budget:0",
+                               "min_rows:3", "fewest_rows"}) {
+        auto assigner_instance = make_assigner("field_arithmetic.ll", full_mode, policy);
+        BOOST_TEST(!assigner_instance->evaluate(input, empty_input), policy);
+    }
+    auto assigner_instance = make_assigner("field_arithmetic.ll", full_mode, "column_budget:15");
+    BOOST_TEST(assigner_instance->evaluate(input, empty_input));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
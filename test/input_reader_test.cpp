@@ -83,6 +83,8 @@ struct LLVMDataFixture {
         BOOST_TEST_REQUIRE(arrays_func != nullptr);
         fields_curves_func = get_func_by_name(module.get(), "fields_curves");
         BOOST_TEST_REQUIRE(fields_curves_func != nullptr);
+        large_array_func = get_func_by_name(module.get(), "large_array");
+        BOOST_TEST_REQUIRE(large_array_func != nullptr);
     }
 
     void test_correct_input(llvm::Function *func,
@@ -95,6 +97,19 @@ struct LLVMDataFixture {
         input_reader.reset();
     }
 
+    void test_correct_stream_input(llvm::Function *func,
+                                   const char *input_string,
+                                   const column_type<BlueprintFieldType>
+                                       expected_result) {
+        std::istringstream public_stream(input_string);
+        std::istringstream private_stream("[]");
+        json_stream_source public_source(public_stream);
+        json_stream_source private_source(private_stream);
+        BOOST_TEST_REQUIRE(input_reader.fill_arguments(*func, public_source, private_source, test_logger));
+        BOOST_TEST(check_vector_equality(input_reader.get_public_input(), expected_result));
+        input_reader.reset();
+    }
+
     void test_error_message(llvm::Function *func, const char *input_string, const char *error_message) {
         auto input_array = read_json_string(input_string);
         BOOST_TEST(input_reader.fill_public_input(*func, input_array, empty_private_input, test_logger) == false);
@@ -107,8 +122,19 @@ struct LLVMDataFixture {
     std::unique_ptr<llvm::Module> module;
     llvm::Function *arrays_func;
     llvm::Function *fields_curves_func;
+    llvm::Function *large_array_func;
 };
 
+std::string large_array_input(std::size_t size, const std::string &last_element) {
+    std::string input = R"([{"array<field<pallas_base>>": [)";
+    for (std::size_t i = 0; i + 1 < size; i++) {
+        // Mix JSON numbers and strings
+        input += i % 2 == 0 ? std::to_string(i) : "\"" + std::to_string(i) + "\"";
+        input += ", ";
+    }
+    return input + last_element + "]}]";
+}
+
 BOOST_FIXTURE_TEST_SUITE(input_reader_suite, LLVMDataFixture)
 
 BOOST_AUTO_TEST_CASE(input_reader_actual_format) {
@@ -207,4 +233,92 @@ BOOST_AUTO_TEST_CASE(input_reader_fields_wrong_amount) {
     test_error_message(fields_curves_func, input_string_wrong_amount, expected_error);
 }
 
+BOOST_AUTO_TEST_CASE(input_reader_stream) {
+
+    column_type<BlueprintFieldType> expected = {1, 2, 3, 4, 5, 6, 7, 8};
+    const char *input_string = R"([ {"array<field<pallas_base>>": [1,2, 3 ]} ,
+                                               {"array<field<pallas_base>>": [ 4, 5, 6, 7, 8]}
+                                  ])";
+    test_correct_stream_input(arrays_func, input_string, expected);
+}
+
+BOOST_AUTO_TEST_CASE(input_reader_stream_too_many_values) {
+
+    std::istringstream public_stream(R"([ {"field<pallas_base>": 1},
+                                          {"field<ed25519_base>" : 2},
+                                          {"curve<pallas>": [4, 5]},
+                                          {"curve<ed25519>": [6, 7]},
+                                          {"curve<bls12381>": [5, 5]}
+                                        ])");
+    std::istringstream private_stream("");
+    json_stream_source public_source(public_stream);
+    json_stream_source private_source(private_stream);
+    BOOST_TEST(input_reader.fill_arguments(*fields_curves_func, public_source, private_source, test_logger) == false);
+    BOOST_TEST(input_reader.get_error() ==
+        "Too many values in the input files, public + private input sizes must be equal to passed argument size");
+    input_reader.reset();
+}
+
+BOOST_AUTO_TEST_CASE(input_reader_binary_input_round_trip) {
+
+    const char *input_string = R"([ {"array<field<pallas_base>>": [1,2, 3 ]} ,
+                                               {"array<field<pallas_base>>": [ 4, 5, 6, 7, 8]}
+                                  ])";
+    boost::json::array input_array = read_json_string(input_string);
+    BOOST_TEST(input_reader.fill_public_input(*arrays_func, input_array, empty_private_input, test_logger));
+    std::vector<binary_input::argument> layout = input_reader.get_argument_layout();
+    BOOST_TEST(layout.size() == 2);
+    BOOST_TEST(layout[0].elements_amount == 3);
+    BOOST_TEST(layout[1].elements_amount == 5);
+
+    column_type<BlueprintFieldType> public_elements = input_reader.get_public_input();
+    public_elements.back() = -BlueprintFieldType::value_type::one();
+    std::string file_name = "input_reader_binary_input_round_trip.bin";
+    BOOST_TEST(write_binary_input<BlueprintFieldType>(file_name, layout, public_elements, {}));
+
+    binary_input input;
+    BOOST_TEST(input.open(file_name));
+    BOOST_TEST(input.get_arguments().size() == 2);
+    BOOST_TEST(input.public_amount() == public_elements.size());
+    BOOST_TEST(input.private_amount() == 0);
+    for (std::size_t i = 0; i < public_elements.size(); i++) {
+        BOOST_TEST(input.public_element<BlueprintFieldType>(i) == public_elements[i]);
+    }
+    input.close();
+    std::remove(file_name.c_str());
+    input_reader.reset();
+}
+
+BOOST_AUTO_TEST_CASE(input_reader_large_array) {
+
+    column_type<BlueprintFieldType> expected;
+    for (std::size_t i = 0; i < 2048; i++) {
+        expected.push_back(i);
+    }
+    std::string input_string = large_array_input(2048, "2047");
+    test_correct_input(large_array_func, input_string.c_str(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(input_reader_large_array_wrong_element) {
+
+    std::string input_string = large_array_input(2048, "1.5");
+    const char *expected_error =
+        "got double value for field argument. Probably the value is too big to be represented as integer. "
+        "You can put it in \"\" to avoid JSON parser restrictions.";
+    test_error_message(large_array_func, input_string.c_str(), expected_error);
+}
+
+BOOST_AUTO_TEST_CASE(input_reader_stream_unterminated) {
+
+    std::istringstream public_stream(R"([ {"array<field<pallas_base>>": [1,2, 3 ]} ,
+                                          {"array<field<pallas_base>>": [ 4, 5, 6, 7, 8]}
+                                        )");
+    std::istringstream private_stream("");
+    json_stream_source public_source(public_stream);
+    json_stream_source private_source(private_stream);
+    BOOST_TEST(input_reader.fill_arguments(*arrays_func, public_source, private_source, test_logger) == false);
+    BOOST_TEST(input_reader.get_error() == "Unexpected end of input");
+    input_reader.reset();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
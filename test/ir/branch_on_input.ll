@@ -0,0 +1,18 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+define dso_local noundef i64 @branch_on_input(i64 noundef %a, i64 noundef %b) local_unnamed_addr #0 {
+entry:
+  %c = icmp ult i64 %a, %b
+  br i1 %c, label %then, label %else
+
+then:
+  %sum = add i64 %a, %b
+  ret i64 %sum
+
+else:
+  %difference = sub i64 %a, %b
+  ret i64 %difference
+}
+
+attributes #0 = { circuit mustprogress nounwind }
@@ -0,0 +1,13 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+define dso_local noundef __zkllvm_field_pallas_base @constant_affine(__zkllvm_field_pallas_base noundef %x) local_unnamed_addr #0 {
+entry:
+  %scaled = mul __zkllvm_field_pallas_base %x, f0x3
+  %shifted = add __zkllvm_field_pallas_base %scaled, f0x5
+  %doubled = mul __zkllvm_field_pallas_base %shifted, f0x2
+  %squared = mul __zkllvm_field_pallas_base %doubled, %doubled
+  ret __zkllvm_field_pallas_base %squared
+}
+
+attributes #0 = { circuit mustprogress nounwind }
@@ -0,0 +1,16 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+define dso_local noundef __zkllvm_field_pallas_base @field_arithmetic(__zkllvm_field_pallas_base noundef %a, __zkllvm_field_pallas_base noundef %b) local_unnamed_addr #0 {
+entry:
+  %add = add __zkllvm_field_pallas_base %a, %b
+  %mul = mul __zkllvm_field_pallas_base %add, %a
+  %mul1 = mul __zkllvm_field_pallas_base %mul, %mul
+  %mul2 = mul __zkllvm_field_pallas_base %mul1, %b
+  %sub = sub __zkllvm_field_pallas_base %b, %a
+  %div = sdiv __zkllvm_field_pallas_base %mul2, %sub
+  %add3 = add __zkllvm_field_pallas_base %div, f0x12345678901234567890
+  ret __zkllvm_field_pallas_base %add3
+}
+
+attributes #0 = { circuit mustprogress nounwind }
@@ -0,0 +1,14 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+define dso_local noundef __zkllvm_curve_curve25519 @fixed_base_multiplication(__zkllvm_field_curve25519_scalar noundef %k) local_unnamed_addr #0 {
+entry:
+  %base = call __zkllvm_curve_curve25519 @llvm.assigner.curve.init.__zkllvm_curve_curve25519.__zkllvm_field_curve25519_base(__zkllvm_field_curve25519_base f0x216936d3cd6e53fec0a4e231fdd6dc5c692cc7609525a7b2c9562d608f25d51a, __zkllvm_field_curve25519_base f0x6666666666666666666666666666666666666666666666666666666666666658)
+  %mul = cmul __zkllvm_curve_curve25519 %base, __zkllvm_field_curve25519_scalar %k
+  ret __zkllvm_curve_curve25519 %mul
+}
+
+declare __zkllvm_curve_curve25519 @llvm.assigner.curve.init.__zkllvm_curve_curve25519.__zkllvm_field_curve25519_base(__zkllvm_field_curve25519_base, __zkllvm_field_curve25519_base) #1
+
+attributes #0 = { circuit mustprogress nounwind }
+attributes #1 = { nocallback nofree nosync nounwind willreturn memory(none) }
@@ -0,0 +1,20 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+define dso_local noundef __zkllvm_field_pallas_base @independent_multiplications(__zkllvm_field_pallas_base noundef %a, __zkllvm_field_pallas_base noundef %b, __zkllvm_field_pallas_base noundef %c, __zkllvm_field_pallas_base noundef %d) local_unnamed_addr #0 {
+entry:
+  %ab = mul __zkllvm_field_pallas_base %a, %b
+  %cd = mul __zkllvm_field_pallas_base %c, %d
+  %ac = mul __zkllvm_field_pallas_base %a, %c
+  %bd = mul __zkllvm_field_pallas_base %b, %d
+  %ad = mul __zkllvm_field_pallas_base %a, %d
+  %bc = mul __zkllvm_field_pallas_base %b, %c
+  %sum0 = add __zkllvm_field_pallas_base %ab, %cd
+  %sum1 = add __zkllvm_field_pallas_base %sum0, %ac
+  %sum2 = add __zkllvm_field_pallas_base %sum1, %bd
+  %sum3 = add __zkllvm_field_pallas_base %sum2, %ad
+  %sum4 = add __zkllvm_field_pallas_base %sum3, %bc
+  ret __zkllvm_field_pallas_base %sum4
+}
+
+attributes #0 = { circuit mustprogress nounwind }
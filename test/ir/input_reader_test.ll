@@ -6,6 +6,7 @@ target triple = "assigner"
 %"struct.array2" = type { [2 x __zkllvm_field_pallas_base] }
 %"struct.array3" = type { [3 x __zkllvm_field_pallas_base] }
 %"struct.array5" = type { [5 x __zkllvm_field_pallas_base] }
+%"struct.array2048" = type { [2048 x __zkllvm_field_pallas_base] }
 
 
 define void @arrays(ptr sret(%"struct.array2") align 1 %agg.result, ptr byval(%"struct.array3") %vertexes, ptr noundef byval(%"struct.array5") %weights) {
@@ -17,3 +18,8 @@ define void @fields_curves(__zkllvm_field_pallas_base %pallas, __zkllvm_field_cu
 entry:
   ret void
 }
+
+define void @large_array(ptr byval(%"struct.array2048") %elements) {
+entry:
+  ret void
+}
@@ -0,0 +1,13 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+define dso_local noundef __zkllvm_field_pallas_base @linear_chain(__zkllvm_field_pallas_base noundef %a, __zkllvm_field_pallas_base noundef %b, __zkllvm_field_pallas_base noundef %c, __zkllvm_field_pallas_base noundef %d, __zkllvm_field_pallas_base noundef %e) local_unnamed_addr #0 {
+entry:
+  %s1 = add __zkllvm_field_pallas_base %a, %b
+  %s2 = sub __zkllvm_field_pallas_base %s1, %c
+  %s3 = add __zkllvm_field_pallas_base %s2, %d
+  %s4 = add __zkllvm_field_pallas_base %s3, %e
+  ret __zkllvm_field_pallas_base %s4
+}
+
+attributes #0 = { circuit mustprogress nounwind }
@@ -0,0 +1,16 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+define dso_local noundef __zkllvm_field_pallas_base @linear_phi(__zkllvm_field_pallas_base noundef %a, __zkllvm_field_pallas_base noundef %b, __zkllvm_field_pallas_base noundef %c) local_unnamed_addr #0 {
+entry:
+  %sum = add __zkllvm_field_pallas_base %a, %b
+  br label %exit
+
+exit:
+  %merged = phi __zkllvm_field_pallas_base [ %sum, %entry ]
+  %difference = sub __zkllvm_field_pallas_base %merged, %c
+  %shifted = add __zkllvm_field_pallas_base %difference, f0x7
+  ret __zkllvm_field_pallas_base %shifted
+}
+
+attributes #0 = { circuit mustprogress nounwind }
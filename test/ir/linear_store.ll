@@ -0,0 +1,15 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+define dso_local noundef __zkllvm_field_pallas_base @linear_store(__zkllvm_field_pallas_base noundef %a, __zkllvm_field_pallas_base noundef %b, __zkllvm_field_pallas_base noundef %c) local_unnamed_addr #0 {
+entry:
+  %cell = alloca __zkllvm_field_pallas_base, align 16
+  %sum = add __zkllvm_field_pallas_base %a, %b
+  %total = add __zkllvm_field_pallas_base %sum, %c
+  store __zkllvm_field_pallas_base %total, ptr %cell, align 16
+  %loaded = load __zkllvm_field_pallas_base, ptr %cell, align 16
+  %product = mul __zkllvm_field_pallas_base %loaded, %a
+  ret __zkllvm_field_pallas_base %product
+}
+
+attributes #0 = { circuit mustprogress nounwind }
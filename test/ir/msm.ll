@@ -0,0 +1,16 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+%"struct.points2" = type { [2 x __zkllvm_curve_curve25519] }
+%"struct.scalars2" = type { [2 x __zkllvm_field_curve25519_scalar] }
+
+define dso_local noundef __zkllvm_curve_curve25519 @msm(ptr noundef byval(%"struct.points2") %points, ptr noundef byval(%"struct.scalars2") %scalars) local_unnamed_addr #0 {
+entry:
+  %sum = call __zkllvm_curve_curve25519 @llvm.assigner.msm.__zkllvm_curve_curve25519(ptr %points, ptr %scalars, i64 2)
+  ret __zkllvm_curve_curve25519 %sum
+}
+
+declare __zkllvm_curve_curve25519 @llvm.assigner.msm.__zkllvm_curve_curve25519(ptr, ptr, i64) #1
+
+attributes #0 = { circuit mustprogress nounwind }
+attributes #1 = { nocallback nofree nosync nounwind willreturn memory(argmem: read) }
@@ -0,0 +1,11 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+define dso_local noundef i64 @narrow_bitwise(i4 noundef %a, i4 noundef %b) local_unnamed_addr #0 {
+entry:
+  %and = and i4 %a, %b
+  %result = zext i4 %and to i64
+  ret i64 %result
+}
+
+attributes #0 = { circuit mustprogress nounwind }
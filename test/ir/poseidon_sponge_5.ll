@@ -0,0 +1,15 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+%"struct.message5" = type { [5 x __zkllvm_field_pallas_base] }
+
+define dso_local noundef __zkllvm_field_pallas_base @poseidon_sponge_5(ptr noundef byval(%"struct.message5") %message) local_unnamed_addr #0 {
+entry:
+  %hash = call __zkllvm_field_pallas_base @llvm.assigner.poseidon.sponge.__zkllvm_field_pallas_base(ptr %message, i64 5)
+  ret __zkllvm_field_pallas_base %hash
+}
+
+declare __zkllvm_field_pallas_base @llvm.assigner.poseidon.sponge.__zkllvm_field_pallas_base(ptr, i64) #1
+
+attributes #0 = { circuit mustprogress nounwind }
+attributes #1 = { nocallback nofree nosync nounwind willreturn memory(argmem: read) }
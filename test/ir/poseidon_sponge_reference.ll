@@ -0,0 +1,29 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+; sponge of 5 elements with rate 2 built from single permutations, the capacity lane starts from the length
+define dso_local noundef __zkllvm_field_pallas_base @poseidon_sponge_reference(__zkllvm_field_pallas_base noundef %m0, __zkllvm_field_pallas_base noundef %m1, __zkllvm_field_pallas_base noundef %m2, __zkllvm_field_pallas_base noundef %m3, __zkllvm_field_pallas_base noundef %m4) local_unnamed_addr #0 {
+entry:
+  %s0 = insertelement <3 x __zkllvm_field_pallas_base> undef, __zkllvm_field_pallas_base %m0, i64 0
+  %s1 = insertelement <3 x __zkllvm_field_pallas_base> %s0, __zkllvm_field_pallas_base %m1, i64 1
+  %s2 = insertelement <3 x __zkllvm_field_pallas_base> %s1, __zkllvm_field_pallas_base f0x5, i64 2
+  %p1 = call <3 x __zkllvm_field_pallas_base> @llvm.assigner.poseidon.v3__zkllvm_field_pallas_base(<3 x __zkllvm_field_pallas_base> %s2)
+  %a0 = extractelement <3 x __zkllvm_field_pallas_base> %p1, i64 0
+  %a1 = extractelement <3 x __zkllvm_field_pallas_base> %p1, i64 1
+  %b0 = add __zkllvm_field_pallas_base %a0, %m2
+  %b1 = add __zkllvm_field_pallas_base %a1, %m3
+  %t0 = insertelement <3 x __zkllvm_field_pallas_base> %p1, __zkllvm_field_pallas_base %b0, i64 0
+  %t1 = insertelement <3 x __zkllvm_field_pallas_base> %t0, __zkllvm_field_pallas_base %b1, i64 1
+  %p2 = call <3 x __zkllvm_field_pallas_base> @llvm.assigner.poseidon.v3__zkllvm_field_pallas_base(<3 x __zkllvm_field_pallas_base> %t1)
+  %c0 = extractelement <3 x __zkllvm_field_pallas_base> %p2, i64 0
+  %d0 = add __zkllvm_field_pallas_base %c0, %m4
+  %u0 = insertelement <3 x __zkllvm_field_pallas_base> %p2, __zkllvm_field_pallas_base %d0, i64 0
+  %p3 = call <3 x __zkllvm_field_pallas_base> @llvm.assigner.poseidon.v3__zkllvm_field_pallas_base(<3 x __zkllvm_field_pallas_base> %u0)
+  %hash = extractelement <3 x __zkllvm_field_pallas_base> %p3, i64 0
+  ret __zkllvm_field_pallas_base %hash
+}
+
+declare <3 x __zkllvm_field_pallas_base> @llvm.assigner.poseidon.v3__zkllvm_field_pallas_base(<3 x __zkllvm_field_pallas_base>) #1
+
+attributes #0 = { circuit mustprogress nounwind }
+attributes #1 = { nocallback nofree nosync nounwind willreturn memory(none) }
@@ -0,0 +1,17 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+%"struct.secret2" = type { [2 x __zkllvm_field_pallas_base] }
+
+define dso_local noundef __zkllvm_field_pallas_base @private_array_product(__zkllvm_field_pallas_base noundef %a, ptr noundef byval(%"struct.secret2") private_input %secret) local_unnamed_addr #0 {
+entry:
+  %first = load __zkllvm_field_pallas_base, ptr %secret, align 16
+  %second.ptr = getelementptr inbounds __zkllvm_field_pallas_base, ptr %secret, i64 1
+  %second = load __zkllvm_field_pallas_base, ptr %second.ptr, align 16
+  %product = mul __zkllvm_field_pallas_base %first, %a
+  %sum = add __zkllvm_field_pallas_base %product, %second
+  %square = mul __zkllvm_field_pallas_base %sum, %sum
+  ret __zkllvm_field_pallas_base %square
+}
+
+attributes #0 = { circuit mustprogress nounwind }
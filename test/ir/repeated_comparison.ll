@@ -0,0 +1,14 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+define dso_local noundef i64 @repeated_comparison(i64 noundef %a, i64 noundef %b) local_unnamed_addr #0 {
+entry:
+  %c1 = icmp ult i64 %a, %b
+  %z1 = zext i1 %c1 to i64
+  %c2 = icmp ult i64 %a, %b
+  %z2 = zext i1 %c2 to i64
+  %s = add i64 %z1, %z2
+  ret i64 %s
+}
+
+attributes #0 = { circuit mustprogress nounwind }
@@ -0,0 +1,13 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+define dso_local noundef i32 @runtime_shift_i32(i32 noundef %x, i32 noundef %s, i32 noundef %right) local_unnamed_addr #0 {
+entry:
+  %left_shifted = shl i32 %x, %s
+  %right_shifted = lshr i32 %x, %s
+  %is_right = icmp ne i32 %right, 0
+  %result = select i1 %is_right, i32 %right_shifted, i32 %left_shifted
+  ret i32 %result
+}
+
+attributes #0 = { circuit mustprogress nounwind }
@@ -0,0 +1,13 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+define dso_local noundef i64 @runtime_shift_i64(i64 noundef %x, i64 noundef %s, i64 noundef %right) local_unnamed_addr #0 {
+entry:
+  %left_shifted = shl i64 %x, %s
+  %right_shifted = lshr i64 %x, %s
+  %is_right = icmp ne i64 %right, 0
+  %result = select i1 %is_right, i64 %right_shifted, i64 %left_shifted
+  ret i64 %result
+}
+
+attributes #0 = { circuit mustprogress nounwind }
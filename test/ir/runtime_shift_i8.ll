@@ -0,0 +1,13 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+define dso_local noundef i8 @runtime_shift_i8(i8 noundef %x, i8 noundef %s, i8 noundef %right) local_unnamed_addr #0 {
+entry:
+  %left_shifted = shl i8 %x, %s
+  %right_shifted = lshr i8 %x, %s
+  %is_right = icmp ne i8 %right, 0
+  %result = select i1 %is_right, i8 %right_shifted, i8 %left_shifted
+  ret i8 %result
+}
+
+attributes #0 = { circuit mustprogress nounwind }
@@ -0,0 +1,15 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+%"struct.message" = type { [56 x i8] }
+
+define dso_local <2 x __zkllvm_field_pallas_base> @sha2_256_stream(ptr noundef byval(%"struct.message") %message) local_unnamed_addr #0 {
+entry:
+  %digest = call <2 x __zkllvm_field_pallas_base> @llvm.assigner.sha2.256.stream.v2__zkllvm_field_pallas_base(ptr %message, i64 56)
+  ret <2 x __zkllvm_field_pallas_base> %digest
+}
+
+declare <2 x __zkllvm_field_pallas_base> @llvm.assigner.sha2.256.stream.v2__zkllvm_field_pallas_base(ptr, i64) #1
+
+attributes #0 = { circuit mustprogress nounwind }
+attributes #1 = { nocallback nofree nosync nounwind willreturn memory(argmem: read) }
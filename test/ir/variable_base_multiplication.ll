@@ -0,0 +1,10 @@
+target datalayout = "e-m:e-p:64:64-i64:64-i128:128-n32:64-S128"
+target triple = "assigner"
+
+define dso_local noundef __zkllvm_curve_curve25519 @variable_base_multiplication(__zkllvm_curve_curve25519 noundef %base, __zkllvm_field_curve25519_scalar noundef %k) local_unnamed_addr #0 {
+entry:
+  %mul = cmul __zkllvm_curve_curve25519 %base, __zkllvm_field_curve25519_scalar %k
+  ret __zkllvm_curve_curve25519 %mul
+}
+
+attributes #0 = { circuit mustprogress nounwind }
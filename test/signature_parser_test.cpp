@@ -54,4 +54,17 @@ BOOST_AUTO_TEST_CASE(input_signature_parser_check_tree) {
     BOOST_TEST(field_kind_node.elem == json_elem::PALLAS_BASE);
 }
 
+BOOST_AUTO_TEST_CASE(input_signature_parser_cache) {
+    signature_cache cache;
+    const signature_node *first = cache.parse("array<field<pallas_base>>");
+    BOOST_TEST(first != nullptr);
+    BOOST_TEST(first->elem == json_elem::ARRAY);
+    BOOST_TEST(cache.parse("array<field<pallas_base>>") == first);
+    BOOST_TEST(cache.parse("struct<int, field<pallas_base>>") != first);
+
+    BOOST_TEST(cache.parse("field<pa") == nullptr);
+    BOOST_TEST(!cache.get_error().empty());
+    BOOST_TEST(cache.parse("array<field<pallas_base>>") == first);
+}
+
 BOOST_AUTO_TEST_SUITE_END()